@@ -0,0 +1,64 @@
+//! [Example 25 - Tape inspection]
+#include <codi.hpp>
+#include <fstream>
+#include <iostream>
+
+//! [Function]
+template<typename Real>
+Real func(Real const* x, size_t n) {
+  Real sum = 0.0;
+  for (size_t i = 0; i < n; i += 1) {
+    sum += x[i] * x[i];
+  }
+
+  return sqrt(sum) + x[0] * x[n - 1];
+}
+//! [Function]
+
+int main(int nargs, char** args) {
+  using Real = codi::RealReverse;
+  using Tape = typename Real::Tape;
+  using Position = typename Tape::Position;
+
+  Tape& tape = Real::getTape();
+
+  size_t const n = 5;
+  Real x[n];
+  for (size_t i = 0; i < n; i += 1) {
+    x[i] = (double)(i + 1);
+  }
+
+  // Step 1: Record the tape
+  tape.setActive();
+  for (size_t i = 0; i < n; i += 1) {
+    tape.registerInput(x[i]);
+  }
+
+  Position start = tape.getPosition();
+  Real y = func(x, n);
+  Position end = tape.getPosition();
+
+  tape.registerOutput(y);
+  tape.setPassive();
+
+  // Step 2: Collect and print the statistics of the whole tape
+  codi::TapeInspector<Real> inspector;
+  inspector.inspect();
+  inspector.printStatistics(std::cout, 3);
+
+  // Step 3: Export the statements of the function
+  std::ofstream dotFile("tape.dot");
+  inspector.writeGraphviz(dotFile, start, end);
+  dotFile.close();
+
+  std::ofstream jsonFile("tape.json");
+  inspector.writeJson(jsonFile, start, end);
+  jsonFile.close();
+
+  std::cout << "Graph written to tape.dot, render it with: dot -Tpdf tape.dot -o tape.pdf" << std::endl;
+
+  tape.reset();
+
+  return 0;
+}
+//! [Example 25 - Tape inspection]
@@ -56,10 +56,14 @@
 #include "codi/tapes/statementEvaluators/reverseStatementEvaluator.hpp"
 #include "codi/tapes/tagging/tagTapeForward.hpp"
 #include "codi/tapes/tagging/tagTapeReverse.hpp"
+#include "codi/tools/data/activeIdentifiers.hpp"
+#include "codi/tools/data/activeVector.hpp"
 #include "codi/tools/data/aggregatedTypeVectorAccessWrapper.hpp"
+#include "codi/tools/data/bitsetGradient.hpp"
 #include "codi/tools/data/direction.hpp"
 #include "codi/tools/data/externalFunctionUserData.hpp"
 #include "codi/tools/data/jacobian.hpp"
+#include "codi/tools/data/pack.hpp"
 #include "codi/tools/derivativeAccess.hpp"
 #include "codi/tools/helpers/customAdjointVectorHelper.hpp"
 #include "codi/tools/helpers/externalFunctionHelper.hpp"
@@ -68,6 +72,10 @@
 #include "codi/tools/helpers/preaccumulationHelper.hpp"
 #include "codi/tools/helpers/statementPushHelper.hpp"
 #include "codi/tools/helpers/tapeHelper.hpp"
+#include "codi/tools/helpers/tapeInspector.hpp"
+#include "codi/tools/helpers/typeDispatchHelper.hpp"
+#include "codi/tools/interval/interval.hpp"
+#include "codi/tools/interval/significanceAnalysis.hpp"
 #include "codi/tools/lowlevelFunctions/lowLevelFunctionCreationUtilities.hpp"
 #include "codi/traits/computationTraits.hpp"
 #include "codi/traits/numericLimits.hpp"
@@ -123,6 +131,10 @@ namespace codi {
   template<size_t dim>
   using RealReverseVec = RealReverseGen<double, Direction<double, dim>>;
 
+  /// Reverse AD type that evaluates and records lanes independent computations at once. See Pack for details.
+  template<size_t lanes>
+  using RealReversePack = RealReverseGen<Pack<double, lanes>>;
+
   /// General unchecked reverse AD type. See \ref sec_reverseAD for a reverse mode AD explanation or \ref ActiveTypeList
   /// for a list of all types.
   ///
@@ -267,3 +279,7 @@ namespace codi {
 #if CODI_EnableOpDiLib
   #include "codi/tools/parallel/openmp/codiOpDiLibTool.hpp"
 #endif
+
+#if CODI_EnableStdThreads
+  #include "codi/tools/parallel/std/codiStd.hpp"
+#endif
@@ -133,6 +133,14 @@ namespace codi {
     size_t constexpr SmallChunkSize = CODI_SmallChunkSize;
 #undef CODI_SmallChunkSize
 
+#ifndef CODI_CacheLineSize
+  /// See codi::Config::CacheLineSize.
+  #define CODI_CacheLineSize 64
+#endif
+    /// Assumed size of a cache line in bytes. Used for padding per-thread data in parallel facilities.
+    size_t constexpr CacheLineSize = CODI_CacheLineSize;
+#undef CODI_CacheLineSize
+
     /// @}
     /*******************************************************************************/
     /// @name Compile time flags
@@ -186,6 +194,15 @@ namespace codi {
     bool constexpr CopyOptimization = CODI_CopyOptimization;
 #undef CODI_CopyOptimization
 
+#ifndef CODI_DistributedAdjointsLock
+  /// See codi::Config::DistributedAdjointsLock.
+  #define CODI_DistributedAdjointsLock false
+#endif
+    /// ThreadSafeGlobalAdjoints protects the adjoint vector with a DistributedReadWriteMutex instead of a
+    /// ReadWriteMutex. Reduces the contention in beginUse and endUse for many threads, makes resizing more expensive.
+    bool constexpr DistributedAdjointsLock = CODI_DistributedAdjointsLock;
+#undef CODI_DistributedAdjointsLock
+
 #ifndef CODI_ImplicitConversion
   /// See codi::Config::ImplicitConversion.
   #define CODI_ImplicitConversion false
@@ -256,6 +273,15 @@ namespace codi {
     bool constexpr SkipZeroAdjointEvaluation = CODI_SkipZeroAdjointEvaluation;
 #undef CODI_SkipZeroAdjointEvaluation
 
+#ifndef CODI_SkipZeroAdjointBlocks
+  /// See codi::Config::SkipZeroAdjointBlocks.
+  #define CODI_SkipZeroAdjointBlocks false
+#endif
+    /// Jacobian tapes with a linear index management track blocks of identifiers with nonzero adjoints and skip whole
+    /// runs of statements with zero adjoints in the reverse evaluation of the internal adjoint vector.
+    bool constexpr SkipZeroAdjointBlocks = CODI_SkipZeroAdjointBlocks;
+#undef CODI_SkipZeroAdjointBlocks
+
 #ifndef CODI_SortIndicesOnReset
   /// See codi::Config::SortIndicesOnReset.
   #define CODI_SortIndicesOnReset true
@@ -264,6 +290,14 @@ namespace codi {
     bool constexpr SortIndicesOnReset = CODI_SortIndicesOnReset;
 #undef CODI_SortIndicesOnReset
 
+#ifndef CODI_TagAnalysis
+  /// See codi::Config::TagAnalysis.
+  #define CODI_TagAnalysis false
+#endif
+    /// Tag data of the tagging tapes carries a dependency set, required for TagTapeBase::setAnalysisEnabled().
+    bool constexpr TagAnalysis = CODI_TagAnalysis;
+#undef CODI_TagAnalysis
+
 #ifndef CODI_VariableAdjointInterfaceInPrimalTapes
   /// See codi::Config::VariableAdjointInterfaceInPrimalTapes.
   #define CODI_VariableAdjointInterfaceInPrimalTapes 0
@@ -289,6 +323,19 @@ namespace codi {
     bool constexpr ReversalZeroesAdjoints = CODI_ReversalZeroesAdjoints;
 #undef CODI_ReversalZeroesAdjoints
 
+#ifndef CODI_PortableTapeFiles
+  /// See codi::Config::PortableTapeFiles.
+  #define CODI_PortableTapeFiles 0
+#endif
+#if CODI_PortableTapeFiles && !(defined(__GXX_RTTI) || defined(_CPPRTTI) || defined(__cpp_rtti))
+  #error CODI_PortableTapeFiles requires RTTI.
+#endif
+    /// Register the statement handles of primal value tapes such that tapes can be written to files that are
+    /// readable by other processes. Requires RTTI. Every statement type that is recorded adds an entry to the
+    /// StatementHandleRegistry during static initialization.
+    bool constexpr PortableTapeFiles = CODI_PortableTapeFiles;
+    // Do not undefine.
+
     /// @}
     /*******************************************************************************/
     /// @name Event system
@@ -364,6 +411,14 @@ namespace codi {
     bool constexpr EnableOpenMP = CODI_EnableOpenMP;
     // Do not undefine.
 
+#ifndef CODI_EnableStdThreads
+  /// See codi::Config::EnableStdThreads.
+  #define CODI_EnableStdThreads false
+#endif
+    /// Add headers for parallel taping with std::thread, based on the C++ standard library.
+    bool constexpr EnableStdThreads = CODI_EnableStdThreads;
+    // Do not undefine.
+
 #ifndef CODI_EnableOpDiLib
   /// See codi::Config::EnableOpDiLib.
   #define CODI_EnableOpDiLib false
@@ -140,7 +140,8 @@ namespace codi {
       }
 
       /// \copydoc codi::LhsExpressionInterface::getTape()
-      static CODI_INLINE Tape& getTape() {
+      /// The return type is the one of the wrapped type, e.g. a temporary tape for ActiveTypeStatelessTape.
+      static CODI_INLINE auto getTape() -> decltype(ActiveType::getTape()) {
         return ActiveType::getTape();
       }
 
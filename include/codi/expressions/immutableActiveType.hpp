@@ -131,7 +131,8 @@ namespace codi {
       }
 
       /// \copydoc codi::LhsExpressionInterface::getTape()
-      static CODI_INLINE Tape& getTape() {
+      /// Forwards the tape of ActiveType unchanged, so stateless tapes return their temporary tape object here as well.
+      static CODI_INLINE auto getTape() -> decltype(ActiveType::getTape()) {
         return ActiveType::getTape();
       }
 
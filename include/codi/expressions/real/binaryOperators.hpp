@@ -704,8 +704,9 @@ namespace codi {
       template<typename ArgA, typename ArgB>
       static CODI_INLINE void checkArguments(ArgA const& argA, ArgB const& argB) {
         if (Config::CheckExpressionArguments) {
+          using std::modf;
           RealTraits::PassiveReal<ArgB> integralPart = 0.0;
-          std::modf(RealTraits::getPassiveValue(argB), &integralPart);
+          modf(RealTraits::getPassiveValue(argB), &integralPart);
 
           if (RealTraits::getPassiveValue(argA) < 0.0 && RealTraits::getPassiveValue(argB) != integralPart) {
             CODI_EXCEPTION("Negative base for non-integral exponent in pow function. (Value: %0.15e)",
@@ -39,6 +39,8 @@
 
 #include "../config.h"
 #include "../tapes/interfaces/fullTapeInterface.hpp"
+#include "../traits/atomicTraits.hpp"
+#include "../traits/gradientTraits.hpp"
 #include "macros.hpp"
 
 /** \copydoc codi::Namespace */
@@ -333,6 +335,8 @@ namespace codi {
       using Gradient = typename Tape::Gradient;         ///< Gradient type used by the tape.
       using Identifier = typename Tape::Identifier;     ///< Identifier type used by the tape.
       using Index = typename Tape::Identifier;          ///< Index type used by the tape.
+      /// Type of the gradient components. Equal to Real, unless the tape uses a different adjoint precision.
+      using GradientValue = AtomicTraits::RemoveAtomic<GradientTraits::Real<Gradient>>;
       using Position = typename Tape::Position;         ///< Position used by the tape.
       /// Vector access interface that is compatible with the Tape.
       using VectorAccess = VectorAccessInterface<Real, Identifier>;
@@ -692,7 +696,7 @@ namespace codi {
        * @param customData  Optional. Custom data that should be linked with the callback, otherwise nullptr.
        */
       static CODI_INLINE Handle registerStatementEvaluateListener(void (*callback)(Tape&, Identifier const&, size_t,
-                                                                                   Real const*, void*),
+                                                                                   GradientValue const*, void*),
                                                                   void* customData = nullptr) {
         return Base::internalRegisterListener(Config::StatementEvents, Event::StatementEvaluate, callback, customData);
       }
@@ -710,9 +714,11 @@ namespace codi {
        * @param lhsAdjoint      Pointer to the left hand side adjoint components.
        */
       static CODI_INLINE void notifyStatementEvaluateListeners(Tape& tape, Identifier const& lhsIdentifier,
-                                                               size_t sizeLhsAdjoint, Real const* lhsAdjoint) {
-        Base::template internalNotifyListeners<void (*)(Tape&, Identifier const&, size_t, Real const*, void*)>(
-            Config::StatementEvents, Event::StatementEvaluate, tape, lhsIdentifier, sizeLhsAdjoint, lhsAdjoint);
+                                                               size_t sizeLhsAdjoint,
+                                                               GradientValue const* lhsAdjoint) {
+        Base::template internalNotifyListeners<void (*)(Tape&, Identifier const&, size_t, GradientValue const*,
+                                                        void*)>(Config::StatementEvents, Event::StatementEvaluate, tape,
+                                                                lhsIdentifier, sizeLhsAdjoint, lhsAdjoint);
       }
 
       /**
@@ -39,8 +39,16 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "../config.h"
 #include "macros.hpp"
@@ -73,55 +81,147 @@ namespace codi {
       }
   };
 
+  /**
+   * @brief Options for the pipelined mode of FileIo.
+   *
+   * With the default values, FileIo reads and writes all data serially on the calling thread.
+   */
+  struct FileIoOptions {
+    public:
+
+      size_t threads;  ///< Number of IO threads. 0 performs the IO on the calling thread.
+      bool checksums;  ///< Store a checksum for each data block and verify it when the data is read.
+      bool append;     ///< In write mode, keep the content of an existing file and start writing at its end.
+
+      /// Constructor
+      FileIoOptions(size_t threads = 0, bool checksums = false, bool append = false)
+          : threads(threads), checksums(checksums), append(append) {}
+
+      /// True if the data blocks are queued instead of transferred directly, see FileIo.
+      bool isPipelined() const {
+        return 0 != threads || checksums;
+      }
+  };
+
   /**
    * @brief Helper structure for writing binary data.
    *
    * Exceptions are thrown if:
    *  - file could not be opened,
    *  - file is used in the wrong mode,
-   *  - number of bytes read/written is wrong.
+   *  - number of bytes read/written is wrong,
+   *  - a checksum does not match.
+   *
+   * In the pipelined mode (see FileIoOptions), writeData() and readData() only record the memory range and the file
+   * offset of each data block. With FileIoOptions::threads worker threads, the workers are started with the first
+   * block and transfer the blocks while further blocks are queued. Each worker uses its own file handle and transfers
+   * the blocks at their precomputed offsets, so the file layout is the same as in the serial mode. Without worker
+   * threads, the blocks are transferred by flush() on the calling thread.
+   *
+   * flush() waits until all queued blocks are transferred. If checksums are enabled, they are computed alongside the
+   * transfers and flush() appends a table with one checksum per block to the file, or verifies it in read mode. The
+   * memory of the data blocks has to stay valid and, in read mode, must not be accessed until flush() has returned.
+   * Errors of the workers are rethrown by flush(). close() flushes, joins the workers and closes the file.
    */
   struct FileIo {
     private:
 
-      FILE* fileHandle;  ///< File handle
-      bool writeMode;    ///< true = write, false = read
+      /// A queued data block of the pipelined mode.
+      struct Block {
+        public:
+
+          char* data;          ///< Memory of the block.
+          size_t size;         ///< Size in bytes.
+          uint64_t offset;     ///< Position in the file.
+          uint64_t checksum;   ///< Checksum of the data.
+      };
+
+      std::string fileName;   ///< Name of the file.
+      FILE* fileHandle;       ///< File handle
+      bool writeMode;         ///< true = write, false = read
+      FileIoOptions options;  ///< Options for the pipelined mode.
+
+      bool checksumActive;       ///< If the serial transfers update runningChecksum, see beginChecksum().
+      uint64_t runningChecksum;  ///< Checksum of the transferred bytes since beginChecksum().
+
+      std::deque<Block> blocks;  ///< Queued blocks in the pipelined mode. References stay valid on insertion.
+      uint64_t fileOffset;       ///< File offset of the next queued block.
+
+      std::vector<std::thread> workers;    ///< Worker threads of the pipelined mode.
+      std::mutex mutex;                    ///< Protects the members below and blocks.
+      std::condition_variable blockAdded;  ///< Signals new blocks and stopWorkers to the workers.
+      std::condition_variable blockDone;   ///< Signals transferred blocks to flush().
+      size_t nextBlock;                    ///< Next block that is picked up by a worker.
+      size_t doneBlocks;                   ///< Number of transferred or skipped blocks.
+      bool stopWorkers;                    ///< Workers exit as soon as all blocks are taken.
+      std::exception_ptr workerError;      ///< First error of a worker, rethrown by flush().
 
     public:
 
       /// Constructor
       /// Will throw an IoException if file cannot be opened.
-      FileIo(std::string const& file, bool write) {
-        writeMode = write;
-        fileHandle = nullptr;
-
-        if (write) {
-          fileHandle = fopen(file.c_str(), "wb");
+      FileIo(std::string const& file, bool write, FileIoOptions const& options = FileIoOptions())
+          : fileName(file),
+            fileHandle(nullptr),
+            writeMode(write),
+            options(options),
+            checksumActive(false),
+            runningChecksum(0),
+            blocks(),
+            fileOffset(0),
+            workers(),
+            mutex(),
+            blockAdded(),
+            blockDone(),
+            nextBlock(0),
+            doneBlocks(0),
+            stopWorkers(false),
+            workerError() {
+        if (write && options.append) {
+          // Not opened with "ab", which would ignore setPosition().
+          fileHandle = fopen(file.c_str(), "r+b");
+          if (nullptr == fileHandle) {
+            fileHandle = openFile(file, "w+b");
+          }
+        } else if (write) {
+          fileHandle = openFile(file, "wb");
         } else {
-          fileHandle = fopen(file.c_str(), "rb");
+          fileHandle = openFile(file, "rb");
         }
 
-        if (nullptr == fileHandle) {
-          throw IoException(IoError::Open, "Could not open file: " + file, true);
+        if (write && options.append) {
+          // Queued blocks are placed after the existing content.
+          seekFile(fileHandle, 0, SEEK_END);
+          fileOffset = tellFile(fileHandle);
         }
       }
 
-      /// Destructor
+      /// Destructor. Waits for the workers but does not report errors, use close() for that.
       ~FileIo() {
+        joinWorkers();
+
         if (nullptr != fileHandle) {
           fclose(fileHandle);
         }
       }
 
+      FileIo(FileIo const&) = delete;             ///< Not copyable, the workers refer to this object.
+      FileIo& operator=(FileIo const&) = delete;  ///< Not copyable, the workers refer to this object.
+
       /// Write data to a file.
       /// Will throw an IoException if not in write mode or if the number of bytes written is wrong.
       template<typename Data>
       void writeData(Data const* data, size_t const length) {
         if (writeMode) {
-          size_t s = fwrite(data, sizeof(Data), length, fileHandle);
+          if (options.isPipelined()) {
+            queueBlock(const_cast<Data*>(data), length);
+          } else {
+            size_t s = fwrite(data, sizeof(Data), length, fileHandle);
 
-          if (s != length) {
-            throw IoException(IoError::Read, "Wrong number of bytes written.", true);
+            if (s != length) {
+              throw IoException(IoError::Write, "Wrong number of bytes written.", true);
+            }
+            updateChecksum(data, length);
           }
         } else {
           throw IoException(IoError::Mode, "Using write io handle in wrong mode.", false);
@@ -133,14 +233,350 @@ namespace codi {
       template<typename Data>
       void readData(Data* data, size_t const length) {
         if (!writeMode) {
-          size_t s = fread(data, sizeof(Data), length, fileHandle);
+          if (options.isPipelined()) {
+            queueBlock(data, length);
+          } else {
+            size_t s = fread(data, sizeof(Data), length, fileHandle);
 
-          if (s != length) {
-            throw IoException(IoError::Read, "Wrong number of bytes read.", false);
+            if (s != length) {
+              throw IoException(IoError::Read, "Wrong number of bytes read.", false);
+            }
+            updateChecksum(data, length);
           }
         } else {
           throw IoException(IoError::Mode, "Using read io handle in wrong mode.", false);
         }
       }
+
+      /// Current position in the file. Only available in the serial mode.
+      uint64_t getPosition() {
+        checkSerialMode();
+
+        return tellFile(fileHandle);
+      }
+
+      /// Continue reading or writing at the given position. Only available in the serial mode.
+      void setPosition(uint64_t position) {
+        checkSerialMode();
+
+        seekFile(fileHandle, position);
+      }
+
+      /// Start a checksum over all bytes that are read or written until endChecksum(). Only available in the serial
+      /// mode. In contrast to FileIoOptions::checksums, the value does not depend on how the data is split into calls.
+      void beginChecksum() {
+        checkSerialMode();
+
+        checksumActive = true;
+        runningChecksum = ChecksumStart;
+      }
+
+      /// Stop the checksum started by beginChecksum() and return it.
+      uint64_t endChecksum() {
+        checksumActive = false;
+
+        return runningChecksum;
+      }
+
+      /// True if all data of the file has been read.
+      bool isEndOfFile() {
+        int c = fgetc(fileHandle);
+        if (EOF == c) {
+          return true;
+        } else {
+          ungetc(c, fileHandle);
+          return false;
+        }
+      }
+
+      /// Wait until all queued blocks of the pipelined mode are transferred. Has no effect in the serial mode.
+      /// Rethrows the first error of the transfers. Will throw an IoException if a checksum does not match.
+      void flush() {
+        if (blocks.empty()) {
+          return;
+        }
+
+        std::exception_ptr error;
+        if (0 == options.threads) {
+          try {
+            for (Block& block : blocks) {
+              transferBlock(fileHandle, block);
+            }
+          } catch (...) {
+            error = std::current_exception();
+          }
+        } else {
+          std::unique_lock<std::mutex> lock(mutex);
+          blockDone.wait(lock, [this]() { return doneBlocks == blocks.size(); });
+          std::swap(error, workerError);
+        }
+
+        if (nullptr == error && options.checksums) {
+          if (writeMode) {
+            writeChecksums();
+          } else {
+            verifyChecksums();
+          }
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          blocks.clear();
+          nextBlock = 0;
+          doneBlocks = 0;
+        }
+
+        if (nullptr != error) {
+          std::rethrow_exception(error);
+        }
+      }
+
+      /// Flush, join the workers and close the file.
+      /// Will throw the errors of flush() and an IoException if the file could not be closed.
+      void close() {
+        try {
+          flush();
+        } catch (...) {
+          joinWorkers();
+          throw;
+        }
+        joinWorkers();
+
+        if (nullptr != workerError) {
+          std::exception_ptr error;
+          std::swap(error, workerError);
+          std::rethrow_exception(error);
+        }
+
+        FILE* handle = fileHandle;
+        fileHandle = nullptr;
+        if (nullptr != handle && 0 != fclose(handle)) {
+          throw IoException(IoError::Write, "Could not close file: " + fileName, true);
+        }
+      }
+
+    private:
+
+      static FILE* openFile(std::string const& file, char const* mode) {
+        FILE* handle = fopen(file.c_str(), mode);
+
+        if (nullptr == handle) {
+          throw IoException(IoError::Open, "Could not open file: " + file, true);
+        }
+
+        return handle;
+      }
+
+      static void seekFile(FILE* handle, uint64_t offset, int origin = SEEK_SET) {
+#ifdef _WIN32
+        int result = _fseeki64(handle, (__int64)offset, origin);
+#else
+        int result = fseeko(handle, (off_t)offset, origin);
+#endif
+        if (0 != result) {
+          throw IoException(IoError::Mode, "Could not seek in file.", true);
+        }
+      }
+
+      static uint64_t tellFile(FILE* handle) {
+#ifdef _WIN32
+        return (uint64_t)_ftelli64(handle);
+#else
+        return (uint64_t)ftello(handle);
+#endif
+      }
+
+      static uint64_t constexpr ChecksumStart = 14695981039346656037ull;  ///< FNV-1a offset basis.
+      static uint64_t constexpr ChecksumPrime = 1099511628211ull;         ///< FNV-1a prime.
+
+      void checkSerialMode() const {
+        if (options.isPipelined()) {
+          throw IoException(IoError::Mode, "Operation is not available in the pipelined mode.", false);
+        }
+      }
+
+      /// Byte wise FNV-1a, continued from runningChecksum.
+      template<typename Data>
+      void updateChecksum(Data const* data, size_t const length) {
+        if (checksumActive) {
+          unsigned char const* bytes = reinterpret_cast<unsigned char const*>(data);
+          size_t const size = sizeof(Data) * length;
+          for (size_t pos = 0; pos < size; pos += 1) {
+            runningChecksum = (runningChecksum ^ (uint64_t)bytes[pos]) * ChecksumPrime;
+          }
+        }
+      }
+
+      /// Word wise FNV-1a variant.
+      static uint64_t computeChecksum(char const* data, size_t size) {
+        uint64_t constexpr Prime = ChecksumPrime;
+        uint64_t hash = ChecksumStart;
+
+        size_t pos = 0;
+        for (; pos + sizeof(uint64_t) <= size; pos += sizeof(uint64_t)) {
+          uint64_t word;
+          memcpy(&word, &data[pos], sizeof(uint64_t));
+          hash = (hash ^ word) * Prime;
+        }
+        for (; pos < size; pos += 1) {
+          hash = (hash ^ (uint64_t)(unsigned char)data[pos]) * Prime;
+        }
+
+        return hash;
+      }
+
+      template<typename Data>
+      void queueBlock(Data* data, size_t const length) {
+        Block block;
+        block.data = reinterpret_cast<char*>(data);
+        block.size = sizeof(Data) * length;
+        block.offset = fileOffset;
+        block.checksum = 0;
+
+        fileOffset += block.size;
+
+        if (0 == options.threads) {
+          blocks.push_back(block);
+        } else {
+          if (workers.empty()) {
+            startWorkers();
+          }
+
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            blocks.push_back(block);
+          }
+          blockAdded.notify_one();
+        }
+      }
+
+      void transferBlock(FILE* handle, Block& block) {
+        seekFile(handle, block.offset);
+
+        if (writeMode) {
+          if (options.checksums) {
+            block.checksum = computeChecksum(block.data, block.size);
+          }
+          if (block.size != fwrite(block.data, 1, block.size, handle) || 0 != fflush(handle)) {
+            throw IoException(IoError::Write, "Wrong number of bytes written.", true);
+          }
+        } else {
+          if (block.size != fread(block.data, 1, block.size, handle)) {
+            throw IoException(IoError::Read, "Wrong number of bytes read.", false);
+          }
+          if (options.checksums) {
+            block.checksum = computeChecksum(block.data, block.size);
+          }
+        }
+      }
+
+      void startWorkers() {
+        // The main handle created the file, the worker handles must not truncate it.
+        fflush(fileHandle);
+
+        stopWorkers = false;
+        for (size_t i = 0; i < options.threads; i += 1) {
+          workers.push_back(std::thread([this]() { runWorker(); }));
+        }
+      }
+
+      void joinWorkers() {
+        if (workers.empty()) {
+          return;
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          stopWorkers = true;
+        }
+        blockAdded.notify_all();
+
+        for (std::thread& worker : workers) {
+          worker.join();
+        }
+        workers.clear();
+      }
+
+      /// Stores the first error. Blocks that are taken after an error are skipped.
+      void storeWorkerError(std::exception_ptr error) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (nullptr == workerError) {
+          workerError = error;
+        }
+      }
+
+      /// Each worker takes the next queued block until stopWorkers is set and all blocks are taken.
+      void runWorker() {
+        FILE* handle = nullptr;
+        try {
+          handle = openFile(fileName, writeMode ? "r+b" : "rb");
+        } catch (...) {
+          storeWorkerError(std::current_exception());
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+          blockAdded.wait(lock, [this]() { return stopWorkers || nextBlock < blocks.size(); });
+          if (nextBlock == blocks.size()) {
+            break;
+          }
+
+          Block& block = blocks[nextBlock];
+          nextBlock += 1;
+          bool const skip = nullptr != workerError || nullptr == handle;
+
+          lock.unlock();
+          if (!skip) {
+            try {
+              transferBlock(handle, block);
+            } catch (...) {
+              storeWorkerError(std::current_exception());
+            }
+          }
+          lock.lock();
+
+          doneBlocks += 1;
+          blockDone.notify_all();
+        }
+        lock.unlock();
+
+        if (nullptr != handle && 0 != fclose(handle)) {
+          IoException error(IoError::Write, "Could not close file: " + fileName, true);
+          storeWorkerError(std::make_exception_ptr(error));
+        }
+      }
+
+      void writeChecksums() {
+        std::vector<uint64_t> checksums(blocks.size() + 1);
+        checksums[0] = (uint64_t)blocks.size();
+        for (size_t i = 0; i < blocks.size(); i += 1) {
+          checksums[i + 1] = blocks[i].checksum;
+        }
+
+        seekFile(fileHandle, fileOffset);
+        if (checksums.size() != fwrite(checksums.data(), sizeof(uint64_t), checksums.size(), fileHandle)) {
+          throw IoException(IoError::Write, "Wrong number of bytes written.", true);
+        }
+      }
+
+      void verifyChecksums() {
+        std::vector<uint64_t> checksums(blocks.size() + 1);
+
+        seekFile(fileHandle, fileOffset);
+        if (checksums.size() != fread(checksums.data(), sizeof(uint64_t), checksums.size(), fileHandle)) {
+          throw IoException(IoError::Read, "Could not read the checksums of file: " + fileName, false);
+        }
+
+        if (checksums[0] != (uint64_t)blocks.size()) {
+          throw IoException(IoError::Read, "Wrong number of checksums in file: " + fileName, false);
+        }
+
+        for (size_t i = 0; i < blocks.size(); i += 1) {
+          if (checksums[i + 1] != blocks[i].checksum) {
+            throw IoException(IoError::Read,
+                              "Checksum mismatch for data block " + std::to_string(i) + " in file: " + fileName, false);
+          }
+        }
+      }
   };
 }
@@ -386,6 +386,64 @@ namespace codi {
       /// @}
 
     private:
+      static uint64_t constexpr CheckpointMarker = 0x504b484369446f43;        // "CoDiCHKP"
+      static uint64_t constexpr CheckpointCommitMarker = 0x544d4d4f43434b43;  // "CKCCOMMT"
+
+      /// Validate the next checkpoint record of the log: header, payload checksum and commit marker. On success, the
+      /// file is positioned after the record. Returns false for the end of the log and for a torn or corrupted record.
+      static bool readCheckpointRecord(FileIo& io, uint64_t& payloadStart, uint64_t& payloadLength) {
+        try {
+          if (io.isEndOfFile()) {
+            return false;
+          }
+
+          uint64_t header[2];
+          io.readData(header, 2);
+          if (CheckpointMarker != header[0] || 0 == header[1]) {
+            return false;
+          }
+
+          payloadStart = io.getPosition();
+          payloadLength = header[1];
+
+          char buffer[4096];
+          io.beginChecksum();
+          for (uint64_t pos = 0; pos < payloadLength; pos += sizeof(buffer)) {
+            io.readData(buffer, (size_t)std::min<uint64_t>(sizeof(buffer), payloadLength - pos));
+          }
+          uint64_t checksum = io.endChecksum();
+
+          uint64_t trailer[3];
+          io.readData(trailer, 3);
+
+          return payloadLength == trailer[0] && checksum == trailer[1] && CheckpointCommitMarker == trailer[2];
+        } catch (IoException const&) {
+          // Short read, the record was not written completely.
+          io.endChecksum();
+          return false;
+        }
+      }
+
+      /// Position after the last valid record of a checkpoint log, zero if the file does not exist.
+      static uint64_t findCheckpointLogEnd(std::string const& filename) {
+        FILE* test = fopen(filename.c_str(), "rb");
+        if (nullptr == test) {
+          return 0;
+        }
+        fclose(test);
+
+        FileIo io(filename, false);
+
+        uint64_t logEnd = 0;
+        uint64_t payloadStart;
+        uint64_t payloadLength;
+        while (readCheckpointRecord(io, payloadStart, payloadLength)) {
+          logEnd = io.getPosition();
+        }
+
+        return logEnd;
+      }
+
       static void writeFunction(const ChunkBase* chunk, FileIo& handle) {
         chunk->writeData(handle);
       }
@@ -402,17 +460,19 @@ namespace codi {
 
       /// @{
       /// \copydoc codi::DataManagementTapeInterface::writeToFile()
-      void writeToFile(const std::string& filename) {
-        FileIo io(filename, true);
+      void writeToFile(const std::string& filename, FileIoOptions const& options = FileIoOptions()) {
+        FileIo io(filename, true, options);
 
         llfByteData.forEachChunk(writeFunction, true, io);
+        io.close();
       }
 
       /// \copydoc codi::DataManagementTapeInterface::readFromFile()
-      void readFromFile(const std::string& filename) {
-        FileIo io(filename, false);
+      void readFromFile(const std::string& filename, FileIoOptions const& options = FileIoOptions()) {
+        FileIo io(filename, false, options);
 
         llfByteData.forEachChunk(readFunction, true, io);
+        io.close();
       }
 
       /// \copydoc codi::DataManagementTapeInterface::deleteData()
@@ -420,6 +480,63 @@ namespace codi {
         llfByteData.forEachChunk(deleteFunction, true);
       }
 
+      /// \copydoc codi::DataManagementTapeInterface::writeCheckpointToFile()
+      void writeCheckpointToFile(std::string const& filename, bool newLog = false) {
+        if (newLog) {
+          llfByteData.invalidateCheckpoint(true);
+        }
+
+        // Overwrite a torn record that an interrupted write left at the end of the log.
+        uint64_t recordStart = 0;
+        if (!newLog) {
+          recordStart = findCheckpointLogEnd(filename);
+        }
+
+        try {
+          FileIo io(filename, true, FileIoOptions(0, false, !newLog));
+          io.setPosition(recordStart);
+
+          // The length in the header stays zero until the record is complete.
+          uint64_t header[2] = {CheckpointMarker, 0};
+          io.writeData(header, 2);
+
+          io.beginChecksum();
+          llfByteData.writeCheckpoint(io, true);
+          uint64_t checksum = io.endChecksum();
+
+          uint64_t length = io.getPosition() - recordStart - sizeof(header);
+          uint64_t trailer[3] = {length, checksum, CheckpointCommitMarker};
+          io.writeData(trailer, 3);
+
+          io.setPosition(recordStart + sizeof(uint64_t));
+          io.writeData(&length, 1);
+          io.close();
+        } catch (...) {
+          // The data is already marked as checkpointed, the next record has to contain all of it.
+          llfByteData.invalidateCheckpoint(true);
+          throw;
+        }
+      }
+
+      /// \copydoc codi::DataManagementTapeInterface::readCheckpointsFromFile()
+      void readCheckpointsFromFile(std::string const& filename) {
+        FileIo io(filename, false);
+
+        uint64_t payloadStart;
+        uint64_t payloadLength;
+        while (readCheckpointRecord(io, payloadStart, payloadLength)) {
+          uint64_t recordEnd = io.getPosition();
+
+          io.setPosition(payloadStart);
+          llfByteData.readCheckpoint(io, true);
+          if (io.getPosition() != payloadStart + payloadLength) {
+            throw IoException(IoError::Read, "Checkpoint record does not match the tape in file: " + filename, false);
+          }
+
+          io.setPosition(recordEnd);
+        }
+      }
+
       /// \copydoc codi::DataManagementTapeInterface::getAvailableParameters()
       std::set<TapeParameters> const& getAvailableParameters() const {
         return options;
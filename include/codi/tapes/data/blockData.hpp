@@ -34,6 +34,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "../../config.h"
@@ -233,6 +234,54 @@ namespace codi {
         nested->swap(*other.nested);
       }
 
+      /*******************************************************************************/
+      /// @name Checkpoints
+
+      /// \copydoc DataInterface::writeCheckpoint <br><br>
+      /// Implementation: Writes the block size and the items that changed.
+      void writeCheckpoint(FileIo& io, bool recursive) {
+        uint64_t record[4] = {chunk.isCheckpointModified(), chunk.getSize(), chunk.getCheckpointValidSize(),
+                              chunk.getUsedSize()};
+        io.writeData(record, 4);
+
+        if (0 != record[0]) {
+          chunk.writeData(io, record[2], record[3]);
+          chunk.setCheckpointed();
+        }
+
+        if (recursive) {
+          nested->writeCheckpoint(io, recursive);
+        }
+      }
+
+      /// \copydoc DataInterface::readCheckpoint
+      void readCheckpoint(FileIo& io, bool recursive) {
+        uint64_t record[4];
+        io.readData(record, 4);
+
+        if (0 != record[0]) {
+          if (chunk.getSize() != record[1]) {
+            chunk.resize(record[1]);
+          }
+          chunk.setUsedSize(record[3]);
+          chunk.readData(io, record[2], record[3]);
+        }
+        chunk.setCheckpointed();
+
+        if (recursive) {
+          nested->readCheckpoint(io, recursive);
+        }
+      }
+
+      /// \copydoc DataInterface::invalidateCheckpoint
+      void invalidateCheckpoint(bool recursive) {
+        chunk.invalidateCheckpoint();
+
+        if (recursive) {
+          nested->invalidateCheckpoint(recursive);
+        }
+      }
+
       /*******************************************************************************/
       /// @name Iterator functions
 
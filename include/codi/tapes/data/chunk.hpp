@@ -70,7 +70,8 @@ namespace codi {
    *
    * - Data IO:
    *   - allocateData() / deleteData(): Allocate / delete the data arrays.
-   *   - readData() / writeData(): Read / write the data in the arrays to the IO object.
+   *   - readData() / writeData(): Read / write the data in the arrays to the IO object. Either all arrays completely
+   *     or only a range of data items.
    *
    */
   struct ChunkBase {
@@ -108,6 +109,11 @@ namespace codi {
       CODI_INLINE virtual void readData(FileIo& handle) = 0;  ///< Read data from the FileIo handle.
       CODI_INLINE virtual void writeData(FileIo& handle) const = 0;  ///< Write data to the FileIo handle.
 
+      /// Read the data items start, ..., end - 1 from the FileIo handle.
+      CODI_INLINE virtual void readData(FileIo& handle, size_t const& start, size_t const& end) = 0;
+      /// Write the data items start, ..., end - 1 to the FileIo handle.
+      CODI_INLINE virtual void writeData(FileIo& handle, size_t const& start, size_t const& end) const = 0;
+
       /// @}
       /*******************************************************************************/
       /// @name Interface: Misc
@@ -120,10 +126,17 @@ namespace codi {
       size_t size;      ///< Maximum size of arrays.
       size_t usedSize;  ///< Currently used size.
 
+      size_t checkpointValidSize;    ///< Number of items that are unchanged since the last checkpoint.
+      size_t checkpointWrittenSize;  ///< Used size at the last checkpoint.
+
     public:
 
+      /// Value of the written size if the chunk is not part of a checkpoint.
+      static size_t constexpr NoCheckpoint = ~size_t(0);
+
       /// Constructor
-      CODI_INLINE explicit ChunkBase(size_t const& size) : size(size), usedSize(0) {}
+      CODI_INLINE explicit ChunkBase(size_t const& size)
+          : size(size), usedSize(0), checkpointValidSize(0), checkpointWrittenSize(NoCheckpoint) {}
 
       /// Destructor
       CODI_INLINE virtual ~ChunkBase() {}
@@ -150,6 +163,7 @@ namespace codi {
       /// Sets the number of used items to zero.
       CODI_INLINE void reset() {
         usedSize = 0;
+        checkpointValidSize = 0;
       }
 
       /// Resize the allocated data. Stored data is lost. Used size is set to zero.
@@ -158,21 +172,59 @@ namespace codi {
         size = newSize;
         usedSize = 0;
         allocateData();
+        invalidateCheckpoint();
       }
 
       /// Set the used size.
       CODI_INLINE void setUsedSize(size_t const& usage) {
         usedSize = usage;
+        limitCheckpointValidSize(usage);
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Checkpoint tracking
+      /// @{
+
+      /// True if items were added or modified since the last checkpoint.
+      CODI_INLINE bool isCheckpointModified() const {
+        return checkpointWrittenSize != usedSize || checkpointWrittenSize != checkpointValidSize;
+      }
+
+      /// Number of items that are unchanged since the last checkpoint.
+      CODI_INLINE size_t getCheckpointValidSize() const {
+        return checkpointValidSize;
+      }
+
+      /// Consider all items as modified.
+      CODI_INLINE void invalidateCheckpoint() {
+        checkpointValidSize = 0;
+        checkpointWrittenSize = NoCheckpoint;
+      }
+
+      /// Consider all items as checkpointed.
+      CODI_INLINE void setCheckpointed() {
+        checkpointValidSize = usedSize;
+        checkpointWrittenSize = usedSize;
       }
 
       /// @}
 
     protected:
 
+      /// Items from pos on are modified.
+      CODI_INLINE void limitCheckpointValidSize(size_t const& pos) {
+        if (pos < checkpointValidSize) {
+          checkpointValidSize = pos;
+        }
+      }
+
       /// Swap the entries of this base class.
       CODI_INLINE void swap(ChunkBase& other) {
         std::swap(size, other.size);
         std::swap(usedSize, other.usedSize);
+        std::swap(checkpointValidSize, other.checkpointValidSize);
+        std::swap(checkpointWrittenSize, other.checkpointWrittenSize);
       }
   };
 
@@ -237,6 +289,8 @@ namespace codi {
         codiAssert(end <= usedSize);
 
         if (start != end) {
+          limitCheckpointValidSize(start);
+
           for (size_t i = 0; i < usedSize - end; ++i) {
             data1[start + i] = data1[end + i];
           }
@@ -258,6 +312,16 @@ namespace codi {
         handle.readData(data1, size);
       }
 
+      /// \copydoc ChunkBase::readData
+      CODI_INLINE void readData(FileIo& handle, size_t const& start, size_t const& end) {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        allocateData();
+
+        handle.readData(&data1[start], end - start);
+      }
+
       /// \copydoc ChunkBase::swap
       CODI_INLINE void swap(Chunk1<Data1>& other) {
         Base::swap(other);
@@ -270,6 +334,14 @@ namespace codi {
         handle.writeData(data1, size);
       }
 
+      /// \copydoc ChunkBase::writeData
+      CODI_INLINE void writeData(FileIo& handle, size_t const& start, size_t const& end) const {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        handle.writeData(&data1[start], end - start);
+      }
+
       /// @}
   };
 
@@ -346,6 +418,8 @@ namespace codi {
         codiAssert(end <= usedSize);
 
         if (start != end) {
+          limitCheckpointValidSize(start);
+
           for (size_t i = 0; i < usedSize - end; ++i) {
             data1[start + i] = data1[end + i];
           }
@@ -372,6 +446,17 @@ namespace codi {
         handle.readData(data2, size);
       }
 
+      /// \copydoc ChunkBase::readData
+      CODI_INLINE void readData(FileIo& handle, size_t const& start, size_t const& end) {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        allocateData();
+
+        handle.readData(&data1[start], end - start);
+        handle.readData(&data2[start], end - start);
+      }
+
       /// \copydoc ChunkBase::swap
       CODI_INLINE void swap(Chunk2<Data1, Data2>& other) {
         Base::swap(other);
@@ -386,6 +471,15 @@ namespace codi {
         handle.writeData(data2, size);
       }
 
+      /// \copydoc ChunkBase::writeData
+      CODI_INLINE void writeData(FileIo& handle, size_t const& start, size_t const& end) const {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        handle.writeData(&data1[start], end - start);
+        handle.writeData(&data2[start], end - start);
+      }
+
       /// @}
   };
 
@@ -475,6 +569,8 @@ namespace codi {
         codiAssert(end <= usedSize);
 
         if (start != end) {
+          limitCheckpointValidSize(start);
+
           for (size_t i = 0; i < usedSize - end; ++i) {
             data1[start + i] = data1[end + i];
           }
@@ -506,6 +602,18 @@ namespace codi {
         handle.readData(data3, size);
       }
 
+      /// \copydoc ChunkBase::readData
+      CODI_INLINE void readData(FileIo& handle, size_t const& start, size_t const& end) {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        allocateData();
+
+        handle.readData(&data1[start], end - start);
+        handle.readData(&data2[start], end - start);
+        handle.readData(&data3[start], end - start);
+      }
+
       /// \copydoc ChunkBase::swap
       CODI_INLINE void swap(Chunk3<Data1, Data2, Data3>& other) {
         Base::swap(other);
@@ -522,6 +630,16 @@ namespace codi {
         handle.writeData(data3, size);
       }
 
+      /// \copydoc ChunkBase::writeData
+      CODI_INLINE void writeData(FileIo& handle, size_t const& start, size_t const& end) const {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        handle.writeData(&data1[start], end - start);
+        handle.writeData(&data2[start], end - start);
+        handle.writeData(&data3[start], end - start);
+      }
+
       /// @}
   };
 
@@ -625,6 +743,8 @@ namespace codi {
         codiAssert(end <= usedSize);
 
         if (start != end) {
+          limitCheckpointValidSize(start);
+
           for (size_t i = 0; i < usedSize - end; ++i) {
             data1[start + i] = data1[end + i];
           }
@@ -661,6 +781,19 @@ namespace codi {
         handle.readData(data4, size);
       }
 
+      /// \copydoc ChunkBase::readData
+      CODI_INLINE void readData(FileIo& handle, size_t const& start, size_t const& end) {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        allocateData();
+
+        handle.readData(&data1[start], end - start);
+        handle.readData(&data2[start], end - start);
+        handle.readData(&data3[start], end - start);
+        handle.readData(&data4[start], end - start);
+      }
+
       /// \copydoc ChunkBase::swap
       CODI_INLINE void swap(Chunk4<Data1, Data2, Data3, Data4>& other) {
         Base::swap(other);
@@ -679,6 +812,17 @@ namespace codi {
         handle.writeData(data4, size);
       }
 
+      /// \copydoc ChunkBase::writeData
+      CODI_INLINE void writeData(FileIo& handle, size_t const& start, size_t const& end) const {
+        codiAssert(start <= end);
+        codiAssert(end <= size);
+
+        handle.writeData(&data1[start], end - start);
+        handle.writeData(&data2[start], end - start);
+        handle.writeData(&data3[start], end - start);
+        handle.writeData(&data4[start], end - start);
+      }
+
       /// @}
   };
 
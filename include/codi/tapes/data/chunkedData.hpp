@@ -34,6 +34,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "../../config.h"
@@ -214,6 +215,11 @@ namespace codi {
 
           // Erase completely covered chunks and free their memory. Covers also the case that there is no such chunk.
           chunks.erase(chunks.begin() + start.chunk + 1, chunks.begin() + end.chunk);
+
+          // The following chunks have moved to other indices.
+          for (size_t i = start.chunk + 1; i < chunks.size(); i += 1) {
+            chunks[i]->invalidateCheckpoint();
+          }
         }
 
         if (recursive) {
@@ -307,6 +313,91 @@ namespace codi {
         nested->swap(*other.nested);
       }
 
+      /*******************************************************************************/
+      /// @name Checkpoints
+
+      /// \copydoc DataInterface::writeCheckpoint <br><br>
+      /// Implementation: Writes the chunk layout and, for each modified chunk, the items that changed.
+      void writeCheckpoint(FileIo& io, bool recursive) {
+        std::vector<uint64_t> modifiedChunks;
+        for (size_t i = 0; i < chunks.size(); i += 1) {
+          if (chunks[i]->isCheckpointModified()) {
+            modifiedChunks.push_back(i);
+          }
+        }
+
+        uint64_t header[4] = {chunkSize, chunks.size(), curChunkIndex, modifiedChunks.size()};
+        io.writeData(header, 4);
+
+        for (uint64_t chunkPos : modifiedChunks) {
+          Chunk* chunk = chunks[chunkPos];
+          uint64_t record[3] = {chunkPos, chunk->getCheckpointValidSize(), chunk->getUsedSize()};
+
+          io.writeData(record, 3);
+          io.writeData(&positions[chunkPos], 1);
+          chunk->writeData(io, record[1], record[2]);
+
+          chunk->setCheckpointed();
+        }
+
+        if (recursive) {
+          nested->writeCheckpoint(io, recursive);
+        }
+      }
+
+      /// \copydoc DataInterface::readCheckpoint
+      void readCheckpoint(FileIo& io, bool recursive) {
+        uint64_t header[4];
+        io.readData(header, 4);
+
+        if (header[0] != chunkSize) {
+          CODI_EXCEPTION("Checkpoint was written with chunk size %d, the data uses chunk size %d.", (int)header[0],
+                         (int)chunkSize);
+        }
+
+        // Adapt the chunk layout.
+        while (chunks.size() < header[1]) {
+          chunks.push_back(new Chunk(chunkSize));
+        }
+        while (chunks.size() > header[1]) {
+          delete chunks.back();
+          chunks.pop_back();
+        }
+        positions.resize(chunks.size(), nested->getZeroPosition());
+
+        for (uint64_t i = 0; i < header[3]; i += 1) {
+          uint64_t record[3];
+          io.readData(record, 3);
+
+          Chunk* chunk = chunks[record[0]];
+          io.readData(&positions[record[0]], 1);
+          chunk->setUsedSize(record[2]);
+          chunk->readData(io, record[1], record[2]);
+        }
+
+        for (Chunk* chunk : chunks) {
+          chunk->setCheckpointed();
+        }
+
+        curChunkIndex = header[2];
+        curChunk = chunks[curChunkIndex];
+
+        if (recursive) {
+          nested->readCheckpoint(io, recursive);
+        }
+      }
+
+      /// \copydoc DataInterface::invalidateCheckpoint
+      void invalidateCheckpoint(bool recursive) {
+        for (Chunk* chunk : chunks) {
+          chunk->invalidateCheckpoint();
+        }
+
+        if (recursive) {
+          nested->invalidateCheckpoint(recursive);
+        }
+      }
+
       /*******************************************************************************/
       /// @name Iterator functions
 
@@ -37,6 +37,7 @@
 #include <vector>
 
 #include "../../config.h"
+#include "../../misc/fileIo.hpp"
 #include "../../misc/macros.hpp"
 #include "../misc/tapeValues.hpp"
 #include "chunk.hpp"
@@ -141,6 +142,14 @@ namespace codi {
    *   - forEachChunk(): Call the function for each data chunk stored by this DataInterface.
    *   - forEachForward() / forEachReverse(): Call a function for each data item in this DataInterface.
    *
+   * Checkpoints:
+   *   - writeCheckpoint(): Write the data that was added or modified since the last checkpoint.
+   *   - readCheckpoint():  Replay a checkpoint written by writeCheckpoint().
+   *   - invalidateCheckpoint(): Consider all data as modified.
+   *
+   * Implementations track the data that is modified by resetTo() and erase() and the data that is appended. Data that
+   * is modified in place via pointers obtained from getDataPointers() or from the evaluation functions is not tracked.
+   * Such modifications require a call to invalidateCheckpoint().
    *
    * @tparam T_NestedData         Nested data vector needs to implement this DataInterface.
    * @tparam T_InternalPosHandle  Position handle of the the implementing class for internal size computations.
@@ -287,6 +296,33 @@ namespace codi {
                                           and only once. */
       void swap(DataInterface& other); /**< Swap with other DataInterface of the same type. */
 
+      /*******************************************************************************/
+      /// @name Checkpoints
+
+      /**
+       * @brief Write all data that was appended or modified since the last call.
+       *
+       * The first call after construction or after invalidateCheckpoint() writes all data. The records of consecutive
+       * calls can be appended to the same file and restored with readCheckpoint() in the same order.
+       *
+       * @param[inout] io         IO handle in write mode.
+       * @param[in]    recursive  True if same call should be performed for all nested DataInterfaces.
+       */
+      void writeCheckpoint(FileIo& io, bool recursive);
+
+      /**
+       * @brief Replay one record written by writeCheckpoint().
+       *
+       * Afterwards, the data is in the state of the corresponding writeCheckpoint() call and counts as checkpointed.
+       *
+       * @param[inout] io         IO handle in read mode.
+       * @param[in]    recursive  True if same call should be performed for all nested DataInterfaces.
+       */
+      void readCheckpoint(FileIo& io, bool recursive);
+
+      /// Mark all data as modified such that the next writeCheckpoint() writes everything.
+      void invalidateCheckpoint(bool recursive);
+
       /*******************************************************************************/
       /// @name Iterator functions
 
@@ -154,6 +154,24 @@ namespace codi {
         CODI_UNUSED(other);
       }
 
+      /*******************************************************************************/
+      /// @name Checkpoints
+
+      /// \copydoc DataInterface::writeCheckpoint
+      void writeCheckpoint(FileIo& io, bool recursive) {
+        CODI_UNUSED(io, recursive);
+      }
+
+      /// \copydoc DataInterface::readCheckpoint
+      void readCheckpoint(FileIo& io, bool recursive) {
+        CODI_UNUSED(io, recursive);
+      }
+
+      /// \copydoc DataInterface::invalidateCheckpoint
+      void invalidateCheckpoint(bool recursive) {
+        CODI_UNUSED(recursive);
+      }
+
       /*******************************************************************************/
       /// @name Iterator functions
 
@@ -36,9 +36,11 @@
 
 #include "../config.h"
 #include "../expressions/lhsExpressionInterface.hpp"
+#include "../expressions/logic/helpers/forEachLeafLogic.hpp"
 #include "../expressions/logic/helpers/jacobianComputationLogic.hpp"
 #include "../misc/macros.hpp"
 #include "../traits/expressionTraits.hpp"
+#include "../traits/gradientTraits.hpp"
 #include "../traits/realTraits.hpp"
 #include "../traits/tapeTraits.hpp"
 #include "interfaces/gradientAccessTapeInterface.hpp"
@@ -111,6 +113,60 @@ namespace codi {
           }
       };
 
+      struct LeafPartialsLogic : public JacobianComputationLogic<LeafPartialsLogic> {
+        public:
+          template<typename Node>
+          CODI_INLINE void handleJacobianOnActive(Node const& node, Real jacobian, Real* partials, size_t& pos) {
+            CODI_UNUSED(node);
+            partials[pos] = jacobian;
+            pos += 1;
+          }
+      };
+
+      struct LeafUpdateLogic : public ForEachLeafLogic<LeafUpdateLogic> {
+        public:
+          template<typename Node>
+          CODI_INLINE void handleActive(Node const& node, Real const* partials, size_t& pos, Gradient& lhsGradient) {
+            using Traits = GradientTraits::TraitsImplementation<Gradient>;
+
+            Real const& jacobian = partials[pos];
+            pos += 1;
+            if (CODI_ENABLE_CHECK(Config::IgnoreInvalidJacobians, RealTraits::isTotalFinite(jacobian))) {
+              Gradient const& leafGradient = node.gradient();
+              for (size_t d = 0; d < Traits::dim; ++d) {
+                Traits::at(lhsGradient, d) += Traits::at(leafGradient, d) * jacobian;
+              }
+            }
+          }
+      };
+
+      /// Scalar gradients: Accumulate directly during the expression traversal.
+      template<typename Rhs>
+      CODI_INLINE void computeTangent(Rhs const& rhs, Gradient& newGradient, std::false_type isVector) {
+        CODI_UNUSED(isVector);
+
+        LocalReverseLogic reversal;
+        reversal.eval(rhs, 1.0, newGradient);
+      }
+
+      /// Vector gradients: Compute the scalar partials of all leaves first, then accumulate each leaf tangent with one
+      /// multiply-add over the vector dimensions. This avoids a temporary vector for each product in the traversal.
+      template<typename Rhs>
+      CODI_INLINE void computeTangent(Rhs const& rhs, Gradient& newGradient, std::true_type isVector) {
+        CODI_UNUSED(isVector);
+
+        size_t constexpr ArgumentCount = ExpressionTraits::NumberOfActiveTypeArguments<Rhs>::value;
+        Real partials[0 == ArgumentCount ? 1 : ArgumentCount];
+
+        size_t pos = 0;
+        LeafPartialsLogic partialsLogic;
+        partialsLogic.eval(rhs, 1.0, partials, pos);
+
+        pos = 0;
+        LeafUpdateLogic updateLogic;
+        updateLogic.eval(rhs, partials, pos, newGradient);
+      }
+
     public:
 
       /// @{
@@ -119,10 +175,10 @@ namespace codi {
       template<typename Lhs, typename Rhs>
       CODI_INLINE void store(LhsExpressionInterface<Real, Gradient, ForwardEvaluation, Lhs>& lhs,
                              ExpressionInterface<Real, Rhs> const& rhs) {
-        LocalReverseLogic reversal;
+        using IsVector = std::integral_constant<bool, (GradientTraits::dim<Gradient>() > 1)>;
 
         Gradient newGradient = Gradient();
-        reversal.eval(rhs.cast(), 1.0, newGradient);
+        computeTangent(rhs.cast(), newGradient, IsVector());
 
         lhs.cast().value() = rhs.cast().getValue();
         lhs.cast().gradient() = newGradient;
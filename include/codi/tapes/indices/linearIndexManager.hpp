@@ -246,6 +246,26 @@ namespace codi {
         std::swap(count, other.count);
       }
 
+      /// \copydoc DataInterface::writeCheckpoint <br><br>
+      /// Implementation: Always writes the current maximum index.
+      void writeCheckpoint(FileIo& io, bool recursive) {
+        CODI_UNUSED(recursive);
+
+        io.writeData(&count, 1);
+      }
+
+      /// \copydoc DataInterface::readCheckpoint
+      void readCheckpoint(FileIo& io, bool recursive) {
+        CODI_UNUSED(recursive);
+
+        io.readData(&count, 1);
+      }
+
+      /// \copydoc DataInterface::invalidateCheckpoint
+      void invalidateCheckpoint(bool recursive) {
+        CODI_UNUSED(recursive);
+      }
+
       /// \copydoc DataInterface::evaluateForward <br><br>
       /// This is a terminating DataInterface. The function object is always called and selectedDepth can be ignored.
       template<int selectedDepth = -1, typename FunctionObject, typename... Args>
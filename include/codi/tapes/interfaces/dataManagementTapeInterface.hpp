@@ -37,6 +37,7 @@
 #include <set>
 
 #include "../../config.h"
+#include "../../misc/fileIo.hpp"
 #include "../../traits/realTraits.hpp"
 #include "../misc/tapeParameters.hpp"
 #include "../misc/vectorAccessInterface.hpp"
@@ -55,7 +56,23 @@ namespace codi {
    * RAM to disk. After writing the tape with writeToFile(), a call to deleteData() ensures that all internal data that
    * was written to disk is freed so that the RAM footprint is minimized. Usually, neither management data nor external
    * function data are exported. This means that the same tape that called writeToFile() has to call readFromFile() and
-   * that offloaded tapes are not meaningful across multiple executions of the application.
+   * that offloaded tapes are not meaningful across multiple executions of the application. For the latter,
+   * PrimalValueLinearTape provides writeToPortableFile() and readFromPortableFile().
+   *
+   * The optional FileIoOptions enable the pipelined mode of FileIo. The data of the chunks is then transferred by
+   * several threads in parallel, and optional checksums detect corrupted files. readFromFile() has to be called with
+   * the same options as writeToFile().
+   *
+   * \section checkpoints Incremental checkpoints
+   * writeCheckpointToFile() appends a checkpoint record to a log file. Each record contains only the tape data that was
+   * appended or modified by resets since the previous record. The first record of a log, started with newLog = true,
+   * contains all data. readCheckpointsFromFile() replays all records of a log and restores the tape data of the last
+   * record. As for writeToFile(), only the recorded data streams are stored, e.g. no primal value vector and no
+   * external function data. The restore has to be performed by the same kind of tape with the same chunk sizes.
+   *
+   * Each record stores its length, a checksum of its data and a commit marker that is written last. If a write was
+   * interrupted, readCheckpointsFromFile() stops at the last complete record and the next writeCheckpointToFile()
+   * overwrites the incomplete one.
    *
    * \section parameters Parameters functions
    * The parameter functions provide access to the sizes of the internal tape implementations. For most of the
@@ -115,9 +132,14 @@ namespace codi {
       /*******************************************************************************/
       /// @name Interface: File IO
 
-      void writeToFile(std::string const& filename) const;  ///< See \ref fileIO.
-      void readFromFile(std::string const& filename);       ///< See \ref fileIO.
-      void deleteData();                                    ///< See \ref fileIO.
+      /// See \ref fileIO.
+      void writeToFile(std::string const& filename, FileIoOptions const& options = FileIoOptions()) const;
+      /// See \ref fileIO.
+      void readFromFile(std::string const& filename, FileIoOptions const& options = FileIoOptions());
+      void deleteData();  ///< See \ref fileIO.
+      /// See \ref checkpoints.
+      void writeCheckpointToFile(std::string const& filename, bool newLog = false);
+      void readCheckpointsFromFile(std::string const& filename);  ///< See \ref checkpoints.
 
       /*******************************************************************************/
       /// @name Interface: Parameters
@@ -0,0 +1,87 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../data/position.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Iterate over the statements of a recorded tape.
+   *
+   * See \ref TapeInterfaces for a general overview of the tape interface design in CoDiPack.
+   *
+   * The iteration visits the statements and low level functions in the order of their recording and calls the
+   * callback object for each of them. It does not evaluate anything and does not require an adjoint vector. The
+   * callback object has to provide the methods
+   * \code{.cpp}
+   *   // Called for each statement. Inputs of linear index tapes are reported with size == 0.
+   *   void handleStatement(Identifier const& lhsIdentifier, Config::ArgumentSize const& size, Real const* jacobians,
+   *                        Identifier const* rhsIdentifiers);
+   *
+   *   // Called for each low level function, e.g. for external functions.
+   *   void handleLowLevelFunction(Config::LowLevelFunctionToken const& token, size_t const& dataSize);
+   * \endcode
+   * The pointers jacobians and rhsIdentifiers are valid for size entries and only during the call.
+   *
+   * TapeInspector uses this interface for statistics and exports of recorded tapes.
+   *
+   * @tparam T_Real        The computation type of a tape, usually chosen as ActiveType::Real.
+   * @tparam T_Identifier  The adjoint/tangent identification type of a tape, usually chosen as ActiveType::Identifier.
+   * @tparam T_Position    Global tape position, usually chosen as Tape::Position.
+   */
+  template<typename T_Real, typename T_Identifier, typename T_Position>
+  struct StatementIteratorTapeInterface {
+    public:
+
+      using Real = CODI_DD(T_Real, double);                 ///< See StatementIteratorTapeInterface.
+      using Identifier = CODI_DD(T_Identifier, int);        ///< See StatementIteratorTapeInterface.
+      using Position = CODI_DD(T_Position, EmptyPosition);  ///< See StatementIteratorTapeInterface.
+
+      /*******************************************************************************/
+      /// @name Interface definition
+
+      /// Iterate over the statements in the range [start, end]. It has to hold start <= end.
+      template<typename Callbacks>
+      void iterateForward(Callbacks&& callbacks, Position const& start, Position const& end);
+
+      /// Iterate over all statements of the tape.
+      template<typename Callbacks>
+      void iterateForward(Callbacks&& callbacks);
+  };
+}
@@ -54,6 +54,7 @@
 #include "data/chunk.hpp"
 #include "data/chunkedData.hpp"
 #include "indices/indexManagerInterface.hpp"
+#include "interfaces/statementIteratorTapeInterface.hpp"
 #include "misc/adjointVectorAccess.hpp"
 #include "misc/duplicateJacobianRemover.hpp"
 #include "misc/localAdjoints.hpp"
@@ -122,7 +123,10 @@ namespace codi {
    * @tparam T_Impl Type of the final implementation.
    */
   template<typename T_TapeTypes, typename T_Impl>
-  struct JacobianBaseTape : public CommonTapeImplementation<T_TapeTypes, T_Impl> {
+  struct JacobianBaseTape : public CommonTapeImplementation<T_TapeTypes, T_Impl>,
+                            public StatementIteratorTapeInterface<
+                                typename T_TapeTypes::Real, typename T_TapeTypes::Identifier,
+                                typename CommonTapeImplementation<T_TapeTypes, T_Impl>::Position> {
     public:
 
       /// See JacobianBaseTape.
@@ -196,9 +200,18 @@ namespace codi {
       template<typename... Args>
       static void internalEvaluateReverse_EvalStatements(Args&&... args);
 
+      /// Call the callbacks of a statement iteration. Arguments are from the recursive eval methods of the
+      /// DataInterface.
+      template<typename... Args>
+      static void internalIterateForward_EvalStatements(Args&&... args);
+
       /// Add statement specific data to the data streams.
       void pushStmtData(Identifier const& index, Config::ArgumentSize const& numberOfArguments);
 
+      /// Call modifyIdentifier on all left hand side identifiers that are stored in the statement data.
+      template<typename Func>
+      void editLhsIdentifiers(Func& modifyIdentifier, Position const& start, Position const& end);
+
       /// @}
 
     public:
@@ -555,6 +568,10 @@ namespace codi {
       CODI_WRAP_FUNCTION_TEMPLATE(Wrap_internalEvaluateForward_EvalStatements,
                                   Impl::template internalEvaluateForward_EvalStatements);
 
+      /// Wrapper helper for improved compiler optimizations.
+      CODI_WRAP_FUNCTION_TEMPLATE(Wrap_internalIterateForward_EvalStatements,
+                                  Impl::template internalIterateForward_EvalStatements);
+
     public:
 
       /// @name Functions from CustomAdjointVectorEvaluationTapeInterface
@@ -592,6 +609,54 @@ namespace codi {
                                                        EventHints::EvaluationKind::Forward, EventHints::Endpoint::End);
       }
 
+      /// @}
+      /*******************************************************************************/
+      /// @name Functions from StatementIteratorTapeInterface
+      /// @{
+
+      /// \copydoc codi::StatementIteratorTapeInterface::iterateForward(Callbacks&&, Position const&, Position const&)
+      template<typename Callbacks>
+      void iterateForward(Callbacks&& callbacks, Position const& start, Position const& end) {
+        Wrap_internalIterateForward_EvalStatements<typename std::remove_reference<Callbacks>::type> iterateFunc;
+        Base::llfByteData.evaluateForward(start, end, iterateFunc, callbacks);
+      }
+
+      /// \copydoc codi::StatementIteratorTapeInterface::iterateForward(Callbacks&&)
+      template<typename Callbacks>
+      void iterateForward(Callbacks&& callbacks) {
+        iterateForward(std::forward<Callbacks>(callbacks), cast().getZeroPosition(), cast().getPosition());
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Identifier editing
+      /// @{
+
+      /**
+       * @brief Calls modifyIdentifier(Identifier&) on all identifiers stored in the range [start, end] of the tape.
+       *
+       * Right hand side identifiers are always visited. Left hand side identifiers are only visited if they are stored
+       * on the tape, that is, for tapes without linear index handling. Data of low level functions is not visited.
+       *
+       * The modified identifiers are used in all later evaluations of the range. This is intended for ranges that are
+       * evaluated with a custom adjoint vector and then removed with resetTo(), e.g. in the PreaccumulationHelper.
+       */
+      template<typename Func>
+      void editIdentifiers(Func&& modifyIdentifier, Position const& start, Position const& end) {
+        using JacobianPosition = typename JacobianData::Position;
+        JacobianPosition startJacobian = Base::llfByteData.template extractPosition<JacobianPosition>(start);
+        JacobianPosition endJacobian = Base::llfByteData.template extractPosition<JacobianPosition>(end);
+
+        auto editFunc = [&modifyIdentifier](Real* jacobian, Identifier* identifier) {
+          CODI_UNUSED(jacobian);
+
+          modifyIdentifier(*identifier);
+        };
+        jacobianData.forEachForward(startJacobian, endJacobian, editFunc);
+
+        cast().editLhsIdentifiers(modifyIdentifier, start, end);
+      }
+
       /// @}
       /*******************************************************************************/
       /// @name Functions from DataManagementTapeInterface
@@ -607,6 +672,20 @@ namespace codi {
         Base::swap(other);
       }
 
+      /**
+       * @brief Swap only the recorded data with other. Adjoint vector, index manager and activity stay with each tape.
+       *
+       * Afterwards, this tape records into the data of other while the identifiers are still created by its own index
+       * manager. This temporarily redirects the recording into a scratch tape. Before swapping back, the recording has to
+       * be reset to the position directly after the first swap.
+       */
+      void swapRecordingData(Impl& other) {
+        Base::llfByteData.swap(other.llfByteData);
+
+        // The data streams have swapped the index managers, swap them back.
+        indexManager.get().swap(other.indexManager.get());
+      }
+
       /// \copydoc codi::DataManagementTapeInterface::deleteAdjointVector()
       void deleteAdjointVector() {
         adjoints.resize(1);
@@ -765,6 +844,97 @@ namespace codi {
         cast().initializeManualPushData(lhsValue, lhsIndex, size);
       }
 
+      /**
+       * @brief Store a batch of hand computed statements given in compressed sparse row (CSR) format.
+       *
+       * Statement i computes lhs[i] = primals[i] with the arguments args[columns[k]] and the Jacobians jacobians[k]
+       * for k in [rowPointers[i], rowPointers[i + 1]). The data vectors are reserved once for several statements, and
+       * the arguments are filtered with the same checks as in regular statements. Statements without arguments make
+       * their lhs passive.
+       *
+       * This is an extension of the ManualStatementPushTapeInterface for Jacobian tapes, see
+       * StatementPushHelper::pushStatementsCSR for the general access.
+       */
+      template<typename LhsVector, typename PrimalVector, typename ArgVector, typename RowVector, typename ColVector,
+               typename JacobiVector>
+      void storeManualCSR(LhsVector& lhs, PrimalVector const& primals, size_t const rows, ArgVector const& args,
+                          RowVector const& rowPointers, ColVector const& columns, JacobiVector const& jacobians) {
+        if (!CODI_ENABLE_CHECK(Config::CheckTapeActivity, cast().isActive())) {
+          for (size_t row = 0; row < rows; row += 1) {
+            indexManager.get().template freeIndex<Impl>(lhs[row].getIdentifier());
+            lhs[row].value() = primals[row];
+          }
+
+          return;
+        }
+
+        // Keep the space that is left unused at the end of a chunk small.
+        size_t const maxBatchSize = std::max(Config::ChunkSize / 16, (size_t)1);
+
+        size_t batchStart = 0;
+        while (batchStart < rows) {
+          // Collect rows for the batch, at least one row is always added.
+          size_t batchEnd = batchStart;
+          size_t batchJacobians = 0;
+          while (batchEnd < rows && batchEnd - batchStart < maxBatchSize) {
+            size_t const rowSize = (size_t)(rowPointers[batchEnd + 1] - rowPointers[batchEnd]);
+            if (Config::MaxArgumentSize <= rowSize) {
+              CODI_EXCEPTION("Adding more than %zu arguments to a statement.", Config::MaxArgumentSize);
+            }
+            if (batchStart != batchEnd && maxBatchSize < batchJacobians + rowSize) {
+              break;
+            }
+
+            batchJacobians += rowSize;
+            batchEnd += 1;
+          }
+
+          statementData.reserveItems(batchEnd - batchStart);
+          jacobianData.reserveItems(batchJacobians);
+
+          for (size_t row = batchStart; row < batchEnd; row += 1) {
+            Real* rowJacobians;
+            Identifier* rowIdentifiers;
+            jacobianData.getDataPointers(rowJacobians, rowIdentifiers);
+
+            size_t numberOfArguments = 0;
+            for (size_t k = (size_t)rowPointers[row]; k < (size_t)rowPointers[row + 1]; k += 1) {
+              Real const jacobian = jacobians[k];
+              Identifier const& identifier = args[columns[k]].getIdentifier();
+
+              if (CODI_ENABLE_CHECK(Config::CheckZeroIndex, 0 != identifier)) {
+                if (CODI_ENABLE_CHECK(Config::IgnoreInvalidJacobians, RealTraits::isTotalFinite(jacobian))) {
+                  if (CODI_ENABLE_CHECK(Config::CheckJacobianIsZero, !RealTraits::isTotalZero(jacobian))) {
+                    rowJacobians[numberOfArguments] = jacobian;
+                    rowIdentifiers[numberOfArguments] = identifier;
+                    numberOfArguments += 1;
+                  }
+                }
+              }
+            }
+
+            if (CODI_ENABLE_CHECK(Config::CheckEmptyStatements, 0 != numberOfArguments)) {
+              jacobianData.addDataSize(numberOfArguments);
+
+              indexManager.get().template assignIndex<Impl>(lhs[row].getIdentifier());
+              cast().pushStmtData(lhs[row].getIdentifier(), (Config::ArgumentSize)numberOfArguments);
+
+              if (Config::StatementEvents) {
+                EventSystem<Impl>::notifyStatementStoreOnTapeListeners(cast(), lhs[row].getIdentifier(),
+                                                                       primals[row], numberOfArguments,
+                                                                       rowIdentifiers, rowJacobians);
+              }
+            } else {
+              indexManager.get().template freeIndex<Impl>(lhs[row].getIdentifier());
+            }
+
+            lhs[row].value() = primals[row];
+          }
+
+          batchStart = batchEnd;
+        }
+      }
+
       /// @}
       /*******************************************************************************/
       /// @name Functions from LowLevelFunctionTapeInterface
@@ -42,11 +42,13 @@
 #include "../expressions/logic/compileTimeTraversalLogic.hpp"
 #include "../expressions/logic/traversalLogic.hpp"
 #include "../misc/macros.hpp"
+#include "../traits/atomicTraits.hpp"
 #include "../traits/expressionTraits.hpp"
 #include "data/chunk.hpp"
 #include "indices/linearIndexManager.hpp"
 #include "interfaces/reverseTapeInterface.hpp"
 #include "jacobianBaseTape.hpp"
+#include "misc/adjointBlockMap.hpp"
 
 /** \copydoc codi::Namespace */
 namespace codi {
@@ -77,10 +79,33 @@ namespace codi {
 
       CODI_STATIC_ASSERT(IndexManager::IsLinear, "This class requires an index manager with a linear scheme.");
 
+    protected:
+
+      AdjointBlockMap adjointBlockMap;  ///< Blocks of the internal adjoint vector that may be nonzero.
+
+    public:
+
       /// Constructor
-      JacobianLinearTape() : Base() {}
+      JacobianLinearTape() : Base(), adjointBlockMap() {}
+
+      using Base::gradient;
+
+      /// \copydoc codi::GradientAccessTapeInterface::gradient(T_Identifier const&, AdjointsManagement) <br><br>
+      /// Implementation: Marks the block of the identifier if Config::SkipZeroAdjointBlocks is enabled.
+      CODI_INLINE Gradient& gradient(Identifier const& identifier,
+                                     AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        if (Config::SkipZeroAdjointBlocks) {
+          adjointBlockMap.markChecked((size_t)identifier);
+        }
+
+        return Base::gradient(identifier, adjointsManagement);
+      }
 
-      using Base::clearAdjoints;
+      /// \copydoc codi::ReverseTapeInterface::clearAdjoints()
+      CODI_INLINE void clearAdjoints(AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        Base::clearAdjoints(adjointsManagement);
+        adjointBlockMap.clear();
+      }
 
       /// \copydoc codi::PositionalEvaluationTapeInterface::clearAdjoints
       void clearAdjoints(Position const& start, Position const& end,
@@ -105,8 +130,67 @@ namespace codi {
         }
       }
 
+      /// \copydoc codi::DataManagementTapeInterface::swap()
+      CODI_INLINE void swap(JacobianLinearTape& other) {
+        adjointBlockMap.swap(other.adjointBlockMap);
+
+        Base::swap(other);
+      }
+
+      /// \copydoc codi::DataManagementTapeInterface::createVectorAccess()
+      AdjointBlockVectorAccess<Real, Identifier, Gradient>* createVectorAccess() {
+        return new AdjointBlockVectorAccess<Real, Identifier, Gradient>(
+            this->adjoints.data(), Config::SkipZeroAdjointBlocks ? &adjointBlockMap : nullptr);
+      }
+
     protected:
 
+      /// Block map for the adjoint vector of an evaluation, nullptr if blocks are not tracked for this vector.
+      template<typename Adjoint>
+      CODI_INLINE static AdjointBlockMap* getAdjointBlockMap(JacobianLinearTape& tape, Adjoint* adjointVector) {
+        if (Config::SkipZeroAdjointBlocks && !AtomicTraits::IsAtomic<Adjoint>::value &&
+            (void*)adjointVector == (void*)tape.adjoints.data()) {
+          return &tape.adjointBlockMap;
+        } else {
+          return nullptr;
+        }
+      }
+
+      /// Performs the AD \ref sec_reverseAD "reverse" equation for a statement and marks the updated blocks.
+      template<typename Adjoint>
+      CODI_INLINE static void incrementAdjointsAndMarkBlocks(AdjointBlockMap& blockMap, Adjoint* adjointVector,
+                                                             Adjoint const& lhsAdjoint,
+                                                             Config::ArgumentSize const& numberOfArguments,
+                                                             size_t& curJacobianPos, Real const* const rhsJacobians,
+                                                             Identifier const* const rhsIdentifiers) {
+        size_t endJacobianPos = curJacobianPos - numberOfArguments;
+
+        if (!RealTraits::isTotalZero(lhsAdjoint)) CODI_Likely {
+          while (endJacobianPos < curJacobianPos) CODI_Likely {
+            curJacobianPos -= 1;
+            Identifier const& rhsIdentifier = rhsIdentifiers[curJacobianPos];
+            adjointVector[rhsIdentifier] += rhsJacobians[curJacobianPos] * lhsAdjoint;
+            blockMap.mark((size_t)rhsIdentifier);
+          }
+        } else CODI_Unlikely {
+          curJacobianPos = endJacobianPos;
+        }
+      }
+
+      /// Skip a statement with a zero left hand side adjoint.
+      template<typename Adjoint>
+      CODI_INLINE static void skipZeroAdjointStatement(JacobianLinearTape& tape, size_t const& curAdjointPos,
+                                                       Config::ArgumentSize const& argsSize, size_t& curJacobianPos) {
+        curJacobianPos -= argsSize;
+
+        if (Config::StatementEvents) {
+          Adjoint const lhsAdjoint = Adjoint();
+          EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
+              tape, (Identifier)curAdjointPos, GradientTraits::dim<Adjoint>(),
+              GradientTraits::toArray(lhsAdjoint).data());
+        }
+      }
+
       /// \copydoc codi::JacobianBaseTape::pushStmtData <br><br>
       /// Only the number of arguments is required for linear index managers.
       CODI_INLINE void pushStmtData(Identifier const& index, Config::ArgumentSize const& numberOfArguments) {
@@ -115,6 +199,13 @@ namespace codi {
         this->statementData.pushData(numberOfArguments);
       }
 
+      /// \copydoc codi::JacobianBaseTape::editLhsIdentifiers <br><br>
+      /// Left hand side identifiers are not stored for linear index managers.
+      template<typename Func>
+      CODI_INLINE void editLhsIdentifiers(Func& modifyIdentifier, Position const& start, Position const& end) {
+        CODI_UNUSED(modifyIdentifier, start, end);
+      }
+
       /// \copydoc codi::JacobianBaseTape::internalEvaluateForward_EvalStatements
       template<typename Adjoint>
       CODI_INLINE static void internalEvaluateForward_EvalStatements(
@@ -134,6 +225,13 @@ namespace codi {
           size_t const& startAdjointPos, size_t const& endAdjointPos) {
         CODI_UNUSED(endJacobianPos, endStmtPos, endLLFByteDataPos, endLLFInfoDataPos);
 
+        AdjointBlockMap* blockMap = getAdjointBlockMap(tape, adjointVector);
+        if (nullptr != blockMap) {
+          // Tangents are written to the adjoint vector, all blocks are considered nonzero.
+          blockMap->resize(endAdjointPos + 1);
+          blockMap->markAll();
+        }
+
         typename Base::template VectorAccess<Adjoint> vectorAccess(adjointVector);
 
         size_t curAdjointPos = startAdjointPos;
@@ -153,8 +251,54 @@ namespace codi {
             Base::incrementTangents(adjointVector, lhsAdjoint, argsSize, curJacobianPos, rhsJacobians, rhsIdentifiers);
             adjointVector[curAdjointPos] = lhsAdjoint;
 
-            EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
-                tape, curAdjointPos, GradientTraits::dim<Adjoint>(), GradientTraits::toArray(lhsAdjoint).data());
+            if (Config::StatementEvents) {
+              EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
+                  tape, curAdjointPos, GradientTraits::dim<Adjoint>(), GradientTraits::toArray(lhsAdjoint).data());
+            }
+          }
+
+          curStmtPos += 1;
+        }
+      }
+
+      /// \copydoc codi::JacobianBaseTape::internalIterateForward_EvalStatements
+      template<typename Callbacks>
+      CODI_INLINE static void internalIterateForward_EvalStatements(
+          /* data from call */
+          Callbacks& callbacks,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from jacobian vector */
+          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          Identifier const* const rhsIdentifiers,
+          /* data from statement vector */
+          size_t& curStmtPos, size_t const& endStmtPos, Config::ArgumentSize const* const numberOfJacobians,
+          /* data from index handler */
+          size_t const& startAdjointPos, size_t const& endAdjointPos) {
+        CODI_UNUSED(endJacobianPos, endStmtPos, endLLFByteDataPos, endLLFInfoDataPos, dataPtr);
+
+        size_t curAdjointPos = startAdjointPos;
+
+        while (curAdjointPos < endAdjointPos) CODI_Likely {
+          curAdjointPos += 1;
+
+          Config::ArgumentSize const argsSize = numberOfJacobians[curStmtPos];
+
+          if (Config::StatementLowLevelFunctionTag == argsSize) CODI_Unlikely {
+            callbacks.handleLowLevelFunction(tokenPtr[curLLFInfoDataPos], (size_t)dataSizePtr[curLLFInfoDataPos]);
+
+            curLLFByteDataPos += dataSizePtr[curLLFInfoDataPos];
+            curLLFInfoDataPos += 1;
+          } else if (Config::StatementInputTag == argsSize) CODI_Unlikely {
+            callbacks.handleStatement((Identifier)curAdjointPos, (Config::ArgumentSize)0, &rhsJacobians[curJacobianPos],
+                                      &rhsIdentifiers[curJacobianPos]);
+          } else CODI_Likely {
+            callbacks.handleStatement((Identifier)curAdjointPos, argsSize, &rhsJacobians[curJacobianPos],
+                                      &rhsIdentifiers[curJacobianPos]);
+            curJacobianPos += argsSize;
           }
 
           curStmtPos += 1;
@@ -180,7 +324,12 @@ namespace codi {
           size_t const& startAdjointPos, size_t const& endAdjointPos) {
         CODI_UNUSED(endJacobianPos, endStmtPos, endLLFByteDataPos, endLLFInfoDataPos);
 
-        typename Base::template VectorAccess<Adjoint> vectorAccess(adjointVector);
+        AdjointBlockMap* blockMap = getAdjointBlockMap(tape, adjointVector);
+        if (nullptr != blockMap) {
+          blockMap->resize(startAdjointPos + 1);
+        }
+
+        AdjointBlockVectorAccess<Real, Identifier, Adjoint> vectorAccess(adjointVector, blockMap);
 
         size_t curAdjointPos = startAdjointPos;
 
@@ -193,20 +342,44 @@ namespace codi {
                 tape, false, curLLFByteDataPos, dataPtr, curLLFInfoDataPos, tokenPtr, dataSizePtr, &vectorAccess);
           } else if (Config::StatementInputTag == argsSize) CODI_Unlikely {
             // Do nothing.
+          } else if (nullptr != blockMap && !blockMap->isMarked(curAdjointPos)) CODI_Unlikely {
+            // All adjoints in the block are zero. Skip the statements down to the beginning of the block without
+            // touching their Jacobian data. Low level functions are evaluated regularly in the next iteration.
+            size_t const blockEnd = std::max(AdjointBlockMap::blockBegin(curAdjointPos), endAdjointPos + 1);
+
+            skipZeroAdjointStatement<Adjoint>(tape, curAdjointPos, argsSize, curJacobianPos);
+            while (blockEnd < curAdjointPos &&
+                   Config::StatementLowLevelFunctionTag != numberOfJacobians[curStmtPos - 1]) CODI_Likely {
+              curAdjointPos -= 1;
+              curStmtPos -= 1;
+
+              Config::ArgumentSize const skipArgsSize = numberOfJacobians[curStmtPos];
+              if (Config::StatementInputTag != skipArgsSize) CODI_Likely {
+                skipZeroAdjointStatement<Adjoint>(tape, curAdjointPos, skipArgsSize, curJacobianPos);
+              }
+            }
           } else CODI_Likely {
             // No input value, perform regular statement evaluation.
 
             Adjoint const lhsAdjoint = adjointVector[curAdjointPos];  // We do not use the zero index, decrement of
                                                                       // curAdjointPos at the end of the loop.
 
-            EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
-                tape, (Identifier)curAdjointPos, GradientTraits::dim<Adjoint>(), GradientTraits::toArray(lhsAdjoint).data());
+            if (Config::StatementEvents) {
+              EventSystem<JacobianLinearTape>::notifyStatementEvaluateListeners(
+                  tape, (Identifier)curAdjointPos, GradientTraits::dim<Adjoint>(), GradientTraits::toArray(lhsAdjoint).data());
+            }
 
             if (Config::ReversalZeroesAdjoints) {
               adjointVector[curAdjointPos] = Adjoint();
             }
 
-            Base::incrementAdjoints(adjointVector, lhsAdjoint, argsSize, curJacobianPos, rhsJacobians, rhsIdentifiers);
+            if (nullptr != blockMap) {
+              incrementAdjointsAndMarkBlocks(*blockMap, adjointVector, lhsAdjoint, argsSize, curJacobianPos,
+                                             rhsJacobians, rhsIdentifiers);
+            } else {
+              Base::incrementAdjoints(adjointVector, lhsAdjoint, argsSize, curJacobianPos, rhsJacobians,
+                                      rhsIdentifiers);
+            }
           }
 
           curAdjointPos -= 1;
@@ -132,6 +132,23 @@ namespace codi {
         this->statementData.pushData(index, numberOfArguments);
       }
 
+      /// \copydoc codi::JacobianBaseTape::editLhsIdentifiers <br><br>
+      /// Low level function entries are skipped.
+      template<typename Func>
+      CODI_INLINE void editLhsIdentifiers(Func& modifyIdentifier, Position const& start, Position const& end) {
+        auto editFunc = [&modifyIdentifier](Identifier* index, Config::ArgumentSize* stmtSize) {
+          if (Config::StatementLowLevelFunctionTag != *stmtSize) {
+            modifyIdentifier(*index);
+          }
+        };
+
+        using StmtPosition = typename StatementData::Position;
+        StmtPosition startStmt = this->llfByteData.template extractPosition<StmtPosition>(start);
+        StmtPosition endStmt = this->llfByteData.template extractPosition<StmtPosition>(end);
+
+        this->statementData.forEachForward(startStmt, endStmt, editFunc);
+      }
+
       /// \copydoc codi::JacobianBaseTape::internalEvaluateForward_EvalStatements
       template<typename Adjoint>
       CODI_INLINE static void internalEvaluateForward_EvalStatements(
@@ -164,9 +181,47 @@ namespace codi {
 
             adjointVector[lhsIdentifiers[curStmtPos]] = lhsAdjoint;
 
-            EventSystem<JacobianReuseTape>::notifyStatementEvaluateListeners(
-                tape, lhsIdentifiers[curStmtPos], GradientTraits::dim<Adjoint>(),
-                GradientTraits::toArray(lhsAdjoint).data());
+            if (Config::StatementEvents) {
+              EventSystem<JacobianReuseTape>::notifyStatementEvaluateListeners(
+                  tape, lhsIdentifiers[curStmtPos], GradientTraits::dim<Adjoint>(),
+                  GradientTraits::toArray(lhsAdjoint).data());
+            }
+          }
+
+          curStmtPos += 1;
+        }
+      }
+
+      /// \copydoc codi::JacobianBaseTape::internalIterateForward_EvalStatements
+      template<typename Callbacks>
+      CODI_INLINE static void internalIterateForward_EvalStatements(
+          /* data from call */
+          Callbacks& callbacks,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from jacobian vector */
+          size_t& curJacobianPos, size_t const& endJacobianPos, Real const* const rhsJacobians,
+          Identifier const* const rhsIdentifiers,
+          /* data from statement vector */
+          size_t& curStmtPos, size_t const& endStmtPos, Identifier const* const lhsIdentifiers,
+          Config::ArgumentSize const* const numberOfJacobians) {
+        CODI_UNUSED(endJacobianPos, endLLFByteDataPos, endLLFInfoDataPos, dataPtr);
+
+        while (curStmtPos < endStmtPos) CODI_Likely {
+          Config::ArgumentSize const argsSize = numberOfJacobians[curStmtPos];
+
+          if (Config::StatementLowLevelFunctionTag == argsSize) CODI_Unlikely {
+            callbacks.handleLowLevelFunction(tokenPtr[curLLFInfoDataPos], (size_t)dataSizePtr[curLLFInfoDataPos]);
+
+            curLLFByteDataPos += dataSizePtr[curLLFInfoDataPos];
+            curLLFInfoDataPos += 1;
+          } else CODI_Likely {
+            callbacks.handleStatement(lhsIdentifiers[curStmtPos], argsSize, &rhsJacobians[curJacobianPos],
+                                      &rhsIdentifiers[curJacobianPos]);
+            curJacobianPos += argsSize;
           }
 
           curStmtPos += 1;
@@ -204,9 +259,11 @@ namespace codi {
           } else CODI_Likely {
             Adjoint const lhsAdjoint = adjointVector[lhsIdentifiers[curStmtPos]];
 
-            EventSystem<JacobianReuseTape>::notifyStatementEvaluateListeners(
-                tape, lhsIdentifiers[curStmtPos], GradientTraits::dim<Adjoint>(),
-                GradientTraits::toArray(lhsAdjoint).data());
+            if (Config::StatementEvents) {
+              EventSystem<JacobianReuseTape>::notifyStatementEvaluateListeners(
+                  tape, lhsIdentifiers[curStmtPos], GradientTraits::dim<Adjoint>(),
+                  GradientTraits::toArray(lhsAdjoint).data());
+            }
 
             adjointVector[lhsIdentifiers[curStmtPos]] = Adjoint();
             Base::incrementAdjoints(adjointVector, lhsAdjoint, argsSize, curJacobianPos, rhsJacobians, rhsIdentifiers);
@@ -0,0 +1,214 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "adjointVectorAccess.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Coarse bitmap that tracks which blocks of identifiers may have nonzero adjoints.
+   *
+   * Identifiers are grouped into blocks of BlockSize consecutive values, each block is represented by one bit. A set
+   * bit means that an adjoint in the block may be nonzero, a cleared bit guarantees that all adjoints in the block are
+   * zero. Bits are only cleared by clear(), therefore the set of marked blocks is always a superset of the blocks with
+   * nonzero adjoints.
+   *
+   * Tapes use the map during the reverse sweep to skip whole runs of statements whose left hand side adjoints are zero.
+   */
+  struct AdjointBlockMap {
+    public:
+
+      static size_t constexpr BlockBits = 6;                       ///< Number of identifier bits per block.
+      static size_t constexpr BlockSize = size_t(1) << BlockBits;  ///< Number of identifiers per block.
+
+    private:
+
+      static size_t constexpr WordBits = 6;  ///< Number of block bits per word.
+
+      std::vector<uint64_t> words;  ///< One bit per block of identifiers.
+
+    public:
+
+      /// Constructor
+      AdjointBlockMap() : words() {}
+
+      /// First identifier of the block that contains the identifier.
+      CODI_INLINE static size_t blockBegin(size_t identifier) {
+        return identifier & ~(BlockSize - 1);
+      }
+
+      /// Ensure that identifiers up to size - 1 can be marked. New blocks are not marked.
+      void resize(size_t size) {
+        size_t const wordCount = wordIndex(size) + 1;
+        if (words.size() < wordCount) {
+          words.resize(wordCount, uint64_t(0));
+        }
+      }
+
+      /// Mark the block of the identifier. The map needs to have the correct size.
+      CODI_INLINE void mark(size_t identifier) {
+        codiAssert(wordIndex(identifier) < words.size());
+
+        words[wordIndex(identifier)] |= bitMask(identifier);
+      }
+
+      /// Mark the block of the identifier. The map is resized if necessary.
+      CODI_INLINE void markChecked(size_t identifier) {
+        resize(identifier + 1);
+        mark(identifier);
+      }
+
+      /// Mark all blocks in the current range of the map.
+      void markAll() {
+        std::fill(words.begin(), words.end(), ~uint64_t(0));
+      }
+
+      /// True if an adjoint in the block of the identifier may be nonzero. Identifiers outside of the map are marked.
+      CODI_INLINE bool isMarked(size_t identifier) const {
+        size_t const pos = wordIndex(identifier);
+
+        return pos >= words.size() || 0 != (words[pos] & bitMask(identifier));
+      }
+
+      /// Clear all marks. Only valid if all adjoints are zero.
+      void clear() {
+        std::fill(words.begin(), words.end(), uint64_t(0));
+      }
+
+      /// Swap the contents with the other map.
+      void swap(AdjointBlockMap& other) {
+        words.swap(other.words);
+      }
+
+    private:
+
+      /// Index of the word that contains the bit for the identifier.
+      CODI_INLINE static size_t wordIndex(size_t identifier) {
+        return identifier >> (BlockBits + WordBits);
+      }
+
+      /// Mask of the bit for the identifier in its word.
+      CODI_INLINE static uint64_t bitMask(size_t identifier) {
+        return uint64_t(1) << ((identifier >> BlockBits) & ((size_t(1) << WordBits) - 1));
+      }
+  };
+
+  /**
+   * @brief Adjoint vector access that marks all updated identifiers in an AdjointBlockMap.
+   *
+   * If no map is given, the access behaves like AdjointVectorAccess.
+   *
+   * @tparam T_Real        The computation type of a tape, usually chosen as ActiveType::Real.
+   * @tparam T_Identifier  The adjoint/tangent identification of a tape, usually chosen as ActiveType::Identifier.
+   * @tparam T_Gradient    The gradient type of a tape, usually chosen as ActiveType::Gradient.
+   */
+  template<typename T_Real, typename T_Identifier, typename T_Gradient>
+  struct AdjointBlockVectorAccess : public AdjointVectorAccess<T_Real, T_Identifier, T_Gradient> {
+    public:
+
+      using Real = CODI_DD(T_Real, double);           ///< See AdjointBlockVectorAccess.
+      using Identifier = CODI_DD(T_Identifier, int);  ///< See AdjointBlockVectorAccess.
+      using Gradient = CODI_DD(T_Gradient, double);   ///< See AdjointBlockVectorAccess.
+
+      using Base = AdjointVectorAccess<Real, Identifier, Gradient>;  ///< Base class abbreviation.
+
+    private:
+
+      AdjointBlockMap* blockMap;  ///< Marked on each update, may be nullptr.
+
+    public:
+
+      /// Constructor. See AdjointVectorAccess for details about the adjoint vector.
+      AdjointBlockVectorAccess(Gradient* adjointVector, AdjointBlockMap* blockMap)
+          : Base(adjointVector), blockMap(blockMap) {}
+
+      /// \copydoc codi::VectorAccessInterface::clone
+      VectorAccessInterface<Real, Identifier>* clone() const {
+        return new AdjointBlockVectorAccess(this->adjointVector, blockMap);
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateAdjointWithLhs
+      void updateAdjointWithLhs(Identifier const& index, Real const& jacobian) {
+        Base::updateAdjointWithLhs(index, jacobian);
+        markBlock(index);
+      }
+
+      /// \copydoc codi::VectorAccessInterface::setLhsTangent
+      void setLhsTangent(Identifier const& index) {
+        Base::setLhsTangent(index);
+        markBlock(index);
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateAdjoint
+      void updateAdjoint(Identifier const& index, size_t dim, Real const& adjoint) {
+        Base::updateAdjoint(index, dim, adjoint);
+        markBlock(index);
+      }
+
+      /// \copydoc codi::VectorAccessInterface::updateAdjointVec
+      void updateAdjointVec(Identifier const& index, Real const* const vec) {
+        Base::updateAdjointVec(index, vec);
+        markBlock(index);
+      }
+
+      /// \copydoc codi::VectorAccessInterface::scatterAddAdjoints
+      void scatterAddAdjoints(Identifier const* indices, size_t size, size_t dim, Real const* adjoints) {
+        Base::scatterAddAdjoints(indices, size, dim, adjoints);
+        if (nullptr != blockMap) {
+          for (size_t i = 0; i < size; i += 1) {
+            blockMap->markChecked((size_t)indices[i]);
+          }
+        }
+      }
+
+    private:
+
+      /// Mark the block of the identifier, if a map is given.
+      CODI_INLINE void markBlock(Identifier const& index) {
+        if (nullptr != blockMap) {
+          blockMap->markChecked((size_t)index);
+        }
+      }
+  };
+}
@@ -167,6 +167,30 @@ namespace codi {
         }
       }
 
+      /*******************************************************************************/
+      /// @name Bulk adjoint access
+
+      /// \copydoc codi::VectorAccessInterface::gatherAdjoints
+      void gatherAdjoints(Identifier const* indices, size_t size, size_t dim, Real* adjoints) {
+        for (size_t i = 0; i < size; i += 1) {
+          adjoints[i] = (Real)GradientTraits::at(adjointVector[indices[i]], dim);
+        }
+      }
+
+      /// \copydoc codi::VectorAccessInterface::resetAdjoints
+      void resetAdjoints(Identifier const* indices, size_t size, size_t dim) {
+        for (size_t i = 0; i < size; i += 1) {
+          GradientTraits::at(adjointVector[indices[i]], dim) = typename GradientTraits::Real<Gradient>();
+        }
+      }
+
+      /// \copydoc codi::VectorAccessInterface::scatterAddAdjoints
+      void scatterAddAdjoints(Identifier const* indices, size_t size, size_t dim, Real const* adjoints) {
+        for (size_t i = 0; i < size; i += 1) {
+          GradientTraits::at(adjointVector[indices[i]], dim) += adjoints[i];
+        }
+      }
+
       /*******************************************************************************/
       /// @name Primal access
 
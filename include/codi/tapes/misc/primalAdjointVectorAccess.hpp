@@ -98,5 +98,19 @@ namespace codi {
       bool hasPrimals() {
         return true;
       }
+
+      /// \copydoc VectorAccessInterface::gatherPrimals
+      void gatherPrimals(Identifier const* indices, size_t size, Real* primals) {
+        for (size_t i = 0; i < size; i += 1) {
+          primals[i] = primalVector[indices[i]];
+        }
+      }
+
+      /// \copydoc VectorAccessInterface::scatterPrimals
+      void scatterPrimals(Identifier const* indices, size_t size, Real const* primals) {
+        for (size_t i = 0; i < size; i += 1) {
+          primalVector[indices[i]] = primals[i];
+        }
+      }
   };
 }
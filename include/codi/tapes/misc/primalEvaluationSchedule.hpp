@@ -0,0 +1,331 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Level schedule for the thread-parallel primal and forward evaluation of primal value tapes.
+   *
+   * The statements of a recording form a directed acyclic graph. Each statement is assigned to a level such that it
+   * only depends on statements in lower levels:
+   *  - read after write: the level is larger than the level of the statements that wrote the arguments,
+   *  - write after read and write after write: for reused identifiers, the level is larger than the levels of all
+   *    earlier statements that read or wrote the left hand side identifier.
+   *
+   * Low level functions act as barriers. They get a level of their own, which is larger than all previous levels and
+   * smaller than all following levels.
+   *
+   * Statements with passive arguments store these in the reserved temporary entries of the primal vector during their
+   * evaluation. They are therefore evaluated serially after the parallel part of their level.
+   *
+   * The schedule stores pointers into the data streams of the tape. It is valid as long as the tape is not reset,
+   * swapped or otherwise modified in the scheduled range.
+   *
+   * Usage: Call reset(), push all statements and low level functions in the order of the recording with
+   * pushStatement() and pushLowLevelFunction(), call finalize(). Afterwards evaluate() can be called repeatedly.
+   *
+   * If OpenMP is enabled by the compiler, the levels are evaluated by the threads of an OpenMP parallel region.
+   * Otherwise the evaluation is serial.
+   *
+   * @tparam T_Real         The computation type of a tape, usually chosen as ActiveType::Real.
+   * @tparam T_Identifier   The adjoint/tangent identification of a tape, usually chosen as ActiveType::Identifier.
+   * @tparam T_PassiveReal  The basic computation type of a tape.
+   * @tparam T_EvalHandle   Handle type of the statement evaluator.
+   * @tparam T_Position     Position type of the tape.
+   */
+  template<typename T_Real, typename T_Identifier, typename T_PassiveReal, typename T_EvalHandle, typename T_Position>
+  struct PrimalEvaluationSchedule {
+    public:
+
+      using Real = CODI_DD(T_Real, double);                 ///< See PrimalEvaluationSchedule.
+      using Identifier = CODI_DD(T_Identifier, int);        ///< See PrimalEvaluationSchedule.
+      using PassiveReal = CODI_DD(T_PassiveReal, double);   ///< See PrimalEvaluationSchedule.
+      using EvalHandle = CODI_DD(T_EvalHandle, void*);      ///< See PrimalEvaluationSchedule.
+      using Position = CODI_DD(T_Position, size_t);         ///< See PrimalEvaluationSchedule.
+
+      /// Data of one scheduled statement. All stream pointers point to the first entry of the statement.
+      struct Statement {
+        public:
+          Identifier lhs;  ///< Left hand side identifier. For low level functions, the index into the low level
+                           ///< function data.
+          Config::ArgumentSize numberOfPassiveArguments;  ///< Config::StatementLowLevelFunctionTag for low level
+                                                          ///< functions.
+          EvalHandle evalHandle;                          ///< Handle for the statement evaluator.
+          PassiveReal const* constantValues;              ///< Constant values of the statement.
+          Real const* passiveValues;                      ///< Passive values of the statement.
+          Identifier const* rhsIdentifiers;               ///< Argument identifiers of the statement.
+          Real* oldPrimalValue;                           ///< Storage for the overwritten primal value, or nullptr.
+      };
+
+      /// Data of one scheduled low level function.
+      struct LowLevelFunction {
+        public:
+          char* dataPtr;                                 ///< Byte data of the low level function stream.
+          size_t byteDataPos;                            ///< Start of the data of the low level function.
+          Config::LowLevelFunctionToken* tokenPtr;       ///< Token data of the low level function stream.
+          Config::LowLevelFunctionDataSize* dataSizePtr;  ///< Data size data of the low level function stream.
+          size_t infoDataPos;                            ///< Position in the token and data size data.
+      };
+
+    private:
+
+      bool built;
+      Position start;
+      Position end;
+
+      std::vector<Statement> statements;
+      std::vector<LowLevelFunction> lowLevelFunctions;
+      std::vector<size_t> levelStart;        // Start of each level in statements, with a final end entry.
+      std::vector<size_t> levelSerialStart;  // Start of the serial part of each level in statements.
+
+      // Only used during the construction.
+      std::vector<size_t> statementKeys;
+      std::vector<size_t> writeLevel;
+      std::vector<size_t> readLevel;
+      size_t barrierLevel;
+      size_t maxLevel;
+
+    public:
+
+      /// Constructor
+      PrimalEvaluationSchedule()
+          : built(false),
+            start(),
+            end(),
+            statements(),
+            lowLevelFunctions(),
+            levelStart(),
+            levelSerialStart(),
+            statementKeys(),
+            writeLevel(),
+            readLevel(),
+            barrierLevel(0),
+            maxLevel(0) {}
+
+      /// True if the schedule has been built for the range [start, end].
+      CODI_INLINE bool isBuiltFor(Position const& start, Position const& end) const {
+        return built && this->start == start && this->end == end;
+      }
+
+      /// Remove all data. The schedule needs to be rebuilt afterwards.
+      void clear() {
+        built = false;
+        std::vector<Statement>().swap(statements);
+        std::vector<LowLevelFunction>().swap(lowLevelFunctions);
+        std::vector<size_t>().swap(levelStart);
+        std::vector<size_t>().swap(levelSerialStart);
+        clearConstructionData();
+      }
+
+      /// Start the construction of a schedule for the range [start, end].
+      void reset(Position const& start, Position const& end) {
+        clear();
+
+        this->start = start;
+        this->end = end;
+      }
+
+      /// Add the next statement of the recording.
+      void pushStatement(Identifier const& lhs, Config::ArgumentSize numberOfPassiveArguments,
+                         EvalHandle const& evalHandle, PassiveReal const* constantValues, Real const* passiveValues,
+                         Identifier const* rhsIdentifiers, size_t numberOfRhsIdentifiers, Real* oldPrimalValue) {
+        size_t level = barrierLevel + 1;
+
+        for (size_t pos = 0; pos < numberOfRhsIdentifiers; pos += 1) {
+          Identifier const& rhs = rhsIdentifiers[pos];
+          if (isTracked(rhs)) {
+            level = std::max(level, getLevel(writeLevel, rhs) + 1);
+          }
+        }
+        level = std::max(level, getLevel(writeLevel, lhs) + 1);
+        level = std::max(level, getLevel(readLevel, lhs) + 1);
+
+        setLevel(writeLevel, lhs, level);
+        for (size_t pos = 0; pos < numberOfRhsIdentifiers; pos += 1) {
+          Identifier const& rhs = rhsIdentifiers[pos];
+          if (isTracked(rhs)) {
+            setLevel(readLevel, rhs, std::max(level, getLevel(readLevel, rhs)));
+          }
+        }
+
+        maxLevel = std::max(maxLevel, level);
+
+        statements.push_back(
+            {lhs, numberOfPassiveArguments, evalHandle, constantValues, passiveValues, rhsIdentifiers, oldPrimalValue});
+        statementKeys.push_back(2 * level + (0 == numberOfPassiveArguments ? 0 : 1));
+      }
+
+      /// Add the next low level function of the recording.
+      void pushLowLevelFunction(char* dataPtr, size_t byteDataPos, Config::LowLevelFunctionToken* tokenPtr,
+                                Config::LowLevelFunctionDataSize* dataSizePtr, size_t infoDataPos) {
+        maxLevel += 1;
+        barrierLevel = maxLevel;
+
+        statements.push_back({(Identifier)lowLevelFunctions.size(), Config::StatementLowLevelFunctionTag, EvalHandle(),
+                              nullptr, nullptr, nullptr, nullptr});
+        statementKeys.push_back(2 * maxLevel + 1);
+
+        lowLevelFunctions.push_back({dataPtr, byteDataPos, tokenPtr, dataSizePtr, infoDataPos});
+      }
+
+      /// Sort the statements by level. Has to be called after all statements have been pushed.
+      void finalize() {
+        size_t const numberOfKeys = 2 * maxLevel + 2;
+
+        // Counting sort, keeps the recording order within each part of a level.
+        std::vector<size_t> keyStart(numberOfKeys + 1, 0);
+        for (size_t const& key : statementKeys) {
+          keyStart[key + 1] += 1;
+        }
+        for (size_t key = 0; key < numberOfKeys; key += 1) {
+          keyStart[key + 1] += keyStart[key];
+        }
+
+        levelStart.resize(maxLevel + 1);
+        levelSerialStart.resize(maxLevel);
+        for (size_t level = 0; level < maxLevel; level += 1) {
+          levelStart[level] = keyStart[2 * (level + 1)];
+          levelSerialStart[level] = keyStart[2 * (level + 1) + 1];
+        }
+        levelStart[maxLevel] = statements.size();
+
+        std::vector<Statement> sorted(statements.size());
+        for (size_t pos = 0; pos < statements.size(); pos += 1) {
+          sorted[keyStart[statementKeys[pos]]++] = statements[pos];
+        }
+        statements.swap(sorted);
+
+        clearConstructionData();
+        built = true;
+      }
+
+      /// Number of levels.
+      size_t getNumberOfLevels() const {
+        return levelSerialStart.size();
+      }
+
+      /// Number of scheduled statements and low level functions.
+      size_t getNumberOfStatements() const {
+        return statements.size();
+      }
+
+      /**
+       * @brief Evaluate all levels in order.
+       *
+       * The statements in the parallel part of a level are distributed over the available threads. The serial part is
+       * evaluated by a single thread. Both functions may be called concurrently for different statements.
+       *
+       * @param stmtFunc  Called as stmtFunc(Statement const&) for each statement.
+       * @param llfFunc   Called as llfFunc(LowLevelFunction const&) for each low level function.
+       */
+      template<typename StmtFunc, typename LLFFunc>
+      void evaluate(StmtFunc&& stmtFunc, LLFFunc&& llfFunc) const {
+        size_t const numberOfLevels = getNumberOfLevels();
+
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif
+        {
+          for (size_t level = 0; level < numberOfLevels; level += 1) {
+            size_t const parallelStart = levelStart[level];
+            size_t const serialStart = levelSerialStart[level];
+            size_t const serialEnd = levelStart[level + 1];
+
+            if (parallelStart != serialStart) {
+#ifdef _OPENMP
+  #pragma omp for schedule(static)
+#endif
+              for (size_t pos = parallelStart; pos < serialStart; pos += 1) {
+                stmtFunc(statements[pos]);
+              }
+            }
+
+            if (serialStart != serialEnd) {
+#ifdef _OPENMP
+  #pragma omp single
+#endif
+              for (size_t pos = serialStart; pos < serialEnd; pos += 1) {
+                Statement const& stmt = statements[pos];
+                if (Config::StatementLowLevelFunctionTag == stmt.numberOfPassiveArguments) CODI_Unlikely {
+                  llfFunc(lowLevelFunctions[stmt.lhs]);
+                } else CODI_Likely {
+                  stmtFunc(stmt);
+                }
+              }
+            }
+          }
+        }
+      }
+
+    private:
+
+      void clearConstructionData() {
+        std::vector<size_t>().swap(statementKeys);
+        std::vector<size_t>().swap(writeLevel);
+        std::vector<size_t>().swap(readLevel);
+        barrierLevel = 0;
+        maxLevel = 0;
+      }
+
+      // The first identifiers are reserved for the passive arguments of a statement.
+      CODI_INLINE static bool isTracked(Identifier const& identifier) {
+        return identifier >= (Identifier)Config::MaxArgumentSize;
+      }
+
+      CODI_INLINE static size_t getLevel(std::vector<size_t> const& levels, Identifier const& identifier) {
+        if ((size_t)identifier < levels.size()) {
+          return levels[identifier];
+        } else {
+          return 0;
+        }
+      }
+
+      CODI_INLINE static void setLevel(std::vector<size_t>& levels, Identifier const& identifier, size_t level) {
+        if ((size_t)identifier >= levels.size()) {
+          levels.resize(std::max((size_t)identifier + 1, 2 * levels.size()), 0);
+        }
+        levels[identifier] = level;
+      }
+  };
+}
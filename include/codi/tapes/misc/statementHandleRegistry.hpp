@@ -0,0 +1,176 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <typeinfo>
+
+#include "../../config.h"
+#include "../../misc/exceptions.hpp"
+#include "../../misc/macros.hpp"
+#include "../../traits/expressionTraits.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Maps the statement evaluation handles of primal value tapes to identifiers that are stable across processes.
+   *
+   * Evaluation handles are function pointers or pointers to static data. Their values change between processes, e.g.
+   * due to address space layout randomization. The registry assigns each handle an identifier that is computed from
+   * the mangled type names of the statement generator and the expression. These identifiers are the same in every
+   * execution of the same build, so they can be stored in tape files and resolved to the local handles when a file is
+   * read.
+   *
+   * Handles are registered during static initialization through StatementHandleRegistration for every statement that a
+   * program can record. The registry also stores the number of active and constant arguments of the expression, which
+   * is required for restoring the argument data of a statement.
+   *
+   * @tparam T_Handle  Handle type of the statement evaluator.
+   */
+  template<typename T_Handle>
+  struct StatementHandleRegistry {
+    public:
+
+      using Handle = CODI_DD(T_Handle, void*);  ///< See StatementHandleRegistry.
+      using Id = uint64_t;                      ///< Stable identifier of a handle.
+
+      /// Data of a registered handle.
+      struct Entry {
+        public:
+          Handle handle;             ///< Handle in this process.
+          size_t activeArguments;    ///< Number of active arguments of the expression.
+          size_t constantArguments;  ///< Number of constant arguments of the expression.
+      };
+
+    private:
+
+      std::map<Id, Entry> entries;
+      std::map<Handle, Id> ids;
+
+      StatementHandleRegistry() : entries(), ids() {}
+
+    public:
+
+      /// The registry is shared by all tapes with the same handle type.
+      static StatementHandleRegistry& getInstance() {
+        static StatementHandleRegistry instance;
+
+        return instance;
+      }
+
+      /// FNV-1a hash of a zero terminated string. Combine several strings by passing the previous result as start.
+      static Id hash(char const* text, Id start = 14695981039346656037ull) {
+        Id value = start;
+        for (; '\0' != *text; ++text) {
+          value ^= (Id)(unsigned char)*text;
+          value *= 1099511628211ull;
+        }
+
+        return value;
+      }
+
+      /// Register a handle with the given identifier. Registering the same handle twice is allowed.
+      Id add(Id id, Handle handle, size_t activeArguments, size_t constantArguments) {
+        typename std::map<Id, Entry>::iterator iter = entries.find(id);
+        if (entries.end() != iter) {
+          if (iter->second.handle != handle) {
+            CODI_EXCEPTION("Statement handle identifier %llu is used for two different handles.",
+                           (unsigned long long)id);
+          }
+        } else {
+          entries[id] = Entry{handle, activeArguments, constantArguments};
+          ids[handle] = id;
+        }
+
+        return id;
+      }
+
+      /// Get the identifier of a handle. Returns false if the handle is not registered.
+      bool getId(Handle handle, Id& id) const {
+        typename std::map<Handle, Id>::const_iterator iter = ids.find(handle);
+        if (ids.end() != iter) {
+          id = iter->second;
+          return true;
+        } else {
+          return false;
+        }
+      }
+
+      /// Get the entry of an identifier. Returns nullptr if the identifier is not registered.
+      Entry const* find(Id id) const {
+        typename std::map<Id, Entry>::const_iterator iter = entries.find(id);
+        if (entries.end() != iter) {
+          return &iter->second;
+        } else {
+          return nullptr;
+        }
+      }
+  };
+
+#if CODI_PortableTapeFiles
+  /**
+   * @brief Registers the handle of one statement type in the StatementHandleRegistry during static initialization.
+   *
+   * The registration is triggered by odr-using #id, e.g. with CODI_UNUSED(&id), in the code that records the
+   * statement.
+   *
+   * @tparam T_Tape       The primal value tape.
+   * @tparam T_Generator  Generator of the statement evaluation functions, see StatementEvaluatorInterface.
+   * @tparam T_Expr       The recorded expression.
+   */
+  template<typename T_Tape, typename T_Generator, typename T_Expr>
+  struct StatementHandleRegistration {
+    public:
+
+      using Tape = CODI_DD(T_Tape, CODI_ANY);            ///< See StatementHandleRegistration.
+      using Generator = CODI_DD(T_Generator, CODI_ANY);  ///< See StatementHandleRegistration.
+      using Expr = CODI_DD(T_Expr, CODI_ANY);            ///< See StatementHandleRegistration.
+
+      using Registry = StatementHandleRegistry<typename Tape::EvalHandle>;  ///< Registry for the handle type.
+
+      static typename Registry::Id const id;  ///< Identifier of the handle.
+  };
+
+  template<typename Tape, typename Generator, typename Expr>
+  typename StatementHandleRegistration<Tape, Generator, Expr>::Registry::Id const
+      StatementHandleRegistration<Tape, Generator, Expr>::id = Registry::getInstance().add(
+          Registry::hash(typeid(Expr).name(), Registry::hash(typeid(Generator).name())),
+          Tape::StatementEvaluator::template createHandle<Tape, Generator, Expr>(),
+          ExpressionTraits::NumberOfActiveTypeArguments<Expr>::value,
+          ExpressionTraits::NumberOfConstantTypeArguments<Expr>::value);
+#endif
+}
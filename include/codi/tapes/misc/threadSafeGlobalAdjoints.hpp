@@ -34,6 +34,9 @@
  */
 #pragma once
 
+#include <type_traits>
+
+#include "../../config.h"
 #include "../../tools/parallel/parallelToolbox.hpp"
 #include "internalAdjointsInterface.hpp"
 
@@ -59,9 +62,12 @@ namespace codi {
       /// See ThreadSafeGlobalAdjoints.
       using ParallelToolbox = CODI_DD(T_ParallelToolbox, CODI_DEFAULT_PARALLEL_TOOLBOX);
 
-      using ReadWriteMutex = typename ParallelToolbox::ReadWriteMutex;  ///< See ParallelToolbox.
-      using LockForUse = typename ParallelToolbox::LockForRead;         ///< See ParallelToolbox.
-      using LockForRealloc = typename ParallelToolbox::LockForWrite;    ///< See ParallelToolbox.
+      /// See ParallelToolbox. The distributed variant is chosen with Config::DistributedAdjointsLock.
+      using ReadWriteMutex = typename std::conditional<Config::DistributedAdjointsLock,
+                                                       typename ParallelToolbox::DistributedReadWriteMutex,
+                                                       typename ParallelToolbox::ReadWriteMutex>::type;
+      using LockForUse = codi::LockForRead<ReadWriteMutex>;       ///< See ParallelToolbox.
+      using LockForRealloc = codi::LockForWrite<ReadWriteMutex>;  ///< See ParallelToolbox.
 
     private:
 
@@ -137,6 +143,6 @@ namespace codi {
       ThreadSafeGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::adjoints(1);
 
   template<typename Gradient, typename Identifier, typename Tape, typename ParallelToolbox>
-  typename CODI_DD(ParallelToolbox, CODI_DEFAULT_PARALLEL_TOOLBOX)::ReadWriteMutex
+  typename ThreadSafeGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::ReadWriteMutex
       ThreadSafeGlobalAdjoints<Gradient, Identifier, Tape, ParallelToolbox>::adjointsMutex;
 }
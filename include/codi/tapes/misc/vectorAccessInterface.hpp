@@ -77,12 +77,20 @@ namespace codi {
    *    - Same as the 'direct adjoint vector access' but all functions just work on one component.
    *    - Same function without the 'Vec' suffix.
    *
+   *  - Bulk adjoint component access:
+   *    - gatherAdjoints(), resetAdjoints(), scatterAddAdjoints(): Same as the 'direct adjoint component access' for
+   *      an array of identifiers. Only one virtual call is performed for the whole array.
+   *
    *  - Primal access: (Optional)
    *    - Only available if 'hasPrimals()' is true
    *    - setPrimal(): Set the primal value
    *    - getPrimal(): Get the primal value
    *    - This access is required for primal values tapes, which need to update or revert primal values during the
    *      tape evaluation.
+   *    - gatherPrimals(), scatterPrimals(): Bulk versions of getPrimal() and setPrimal().
+   *
+   * The bulk functions have default implementations that call the element-wise functions. Implementations should
+   * override them with plain loops over their vectors.
    *
    * @tparam T_Real        The computation type of a tape, usually chosen as ActiveType::Real.
    * @tparam T_Identifier  The adjoint/tangent identification of a tape, usually chosen as ActiveType::Identifier.
@@ -138,6 +146,30 @@ namespace codi {
                                  Real const& adjoint) = 0;  ///< Update the adjoint component.
       virtual void updateAdjointVec(Identifier const& index, Real const* const vec) = 0;  ///< Update the adjoint entry.
 
+      /*******************************************************************************/
+      /// @name Bulk adjoint access
+
+      /// Get the adjoint components of all identifiers, adjoints[i] = getAdjoint(indices[i], dim).
+      virtual void gatherAdjoints(Identifier const* indices, size_t size, size_t dim, Real* adjoints) {
+        for (size_t i = 0; i < size; i += 1) {
+          adjoints[i] = getAdjoint(indices[i], dim);
+        }
+      }
+
+      /// Set the adjoint components of all identifiers to zero.
+      virtual void resetAdjoints(Identifier const* indices, size_t size, size_t dim) {
+        for (size_t i = 0; i < size; i += 1) {
+          resetAdjoint(indices[i], dim);
+        }
+      }
+
+      /// Update the adjoint components of all identifiers, updateAdjoint(indices[i], dim, adjoints[i]).
+      virtual void scatterAddAdjoints(Identifier const* indices, size_t size, size_t dim, Real const* adjoints) {
+        for (size_t i = 0; i < size; i += 1) {
+          updateAdjoint(indices[i], dim, adjoints[i]);
+        }
+      }
+
       /*******************************************************************************/
       /// @name Primal access
 
@@ -145,5 +177,19 @@ namespace codi {
       virtual Real getPrimal(Identifier const& index) = 0;                      ///< Get the primal value.
 
       virtual bool hasPrimals() = 0;  ///< True if the tape/vector interface has primal values.
+
+      /// Get the primal values of all identifiers, primals[i] = getPrimal(indices[i]).
+      virtual void gatherPrimals(Identifier const* indices, size_t size, Real* primals) {
+        for (size_t i = 0; i < size; i += 1) {
+          primals[i] = getPrimal(indices[i]);
+        }
+      }
+
+      /// Set the primal values of all identifiers, setPrimal(indices[i], primals[i]).
+      virtual void scatterPrimals(Identifier const* indices, size_t size, Real const* primals) {
+        for (size_t i = 0; i < size; i += 1) {
+          setPrimal(indices[i], primals[i]);
+        }
+      }
   };
 }
@@ -56,6 +56,8 @@
 #include "data/chunkedData.hpp"
 #include "indices/indexManagerInterface.hpp"
 #include "misc/primalAdjointVectorAccess.hpp"
+#include "misc/primalEvaluationSchedule.hpp"
+#include "misc/statementHandleRegistry.hpp"
 #include "statementEvaluators/statementEvaluatorInterface.hpp"
 #include "statementEvaluators/statementEvaluatorTapeInterface.hpp"
 
@@ -168,6 +170,9 @@ namespace codi {
       using VectorAccess =
           PrimalAdjointVectorAccess<Real, Identifier, Adjoint>;  ///< Vector access type generated by this tape.
 
+      /// Level schedule for the thread-parallel primal and forward evaluation.
+      using PrimalSchedule = PrimalEvaluationSchedule<Real, Identifier, PassiveReal, EvalHandle, Position>;
+
       static bool constexpr AllowJacobianOptimization = false;  ///< See InternalStatementRecordingTapeInterface.
       static bool constexpr HasPrimalValues = true;             ///< See PrimalEvaluationTapeInterface.
       static bool constexpr LinearIndexHandling =
@@ -189,6 +194,8 @@ namespace codi {
       std::vector<Real> primals;       ///< Current state of primal values in the program.
       std::vector<Real> primalsCopy;   ///< Copy of primal values for AD evaluations.
 
+      PrimalSchedule primalSchedule;  ///< Level schedule for evaluatePrimalParallel and evaluateForwardParallel.
+
     private:
 
       CODI_INLINE Impl const& cast() const {
@@ -213,6 +220,11 @@ namespace codi {
       template<typename... Args>
       static void internalEvaluatePrimal_EvalStatements(Args&&... args);
 
+      /// Perform a primal evaluation of the tape and add all statements to the PrimalSchedule. Arguments are from the
+      /// recursive eval methods of the DataInterface.
+      template<typename... Args>
+      static void internalEvaluatePrimalBuildSchedule_EvalStatements(Args&&... args);
+
       /// Perform a reverse evaluation of the tape. Arguments are from the recursive eval methods of the DataInterface.
       template<typename... Args>
       static void internalEvaluateReverse_EvalStatements(Args&&... args);
@@ -220,6 +232,9 @@ namespace codi {
       /// Reset the primal values to the given position.
       void internalResetPrimalValues(Position const& pos);
 
+      /// Called before the primal value vector is accessed or resized. Throws a CODI_EXCEPTION if it is not available.
+      void internalCheckPrimalValuesAvailable() const;
+
       /// Add statement specific data to the data streams.
       void pushStmtData(Identifier const& index, Config::ArgumentSize const& numberOfPassiveArguments,
                         Real const& oldPrimalValue, EvalHandle evalHandle);
@@ -239,7 +254,8 @@ namespace codi {
             constantValueData(std::max(Config::ChunkSize, Config::MaxArgumentSize)),
             adjoints(1),  // Ensure that adjoint[0] exists, see its use in gradient() const.
             primals(0),
-            primalsCopy(0) {
+            primalsCopy(0),
+            primalSchedule() {
         checkPrimalSize(true);
 
         statementData.setNested(&indexManager.get());
@@ -418,6 +434,9 @@ namespace codi {
             Real& primalEntry = primals[lhs.cast().getIdentifier()];
             cast().pushStmtData(lhs.cast().getIdentifier(), passiveArguments, primalEntry,
                                 StatementEvaluator::template createHandle<Impl, Impl, Rhs>());
+#if CODI_PortableTapeFiles
+            CODI_UNUSED(&StatementHandleRegistration<Impl, Impl, Rhs>::id);
+#endif
 
             primalEntry = rhs.cast().getValue();
 
@@ -496,6 +515,9 @@ namespace codi {
         if (TapeTypes::IsLinearIndexHandler) {
           cast().pushStmtData(value.cast().getIdentifier(), Config::StatementInputTag, primalEntry,
                               StatementEvaluator::template createHandle<Impl, Impl, Lhs>());
+#if CODI_PortableTapeFiles
+          CODI_UNUSED(&StatementHandleRegistration<Impl, Impl, Lhs>::id);
+#endif
         }
 
         Real oldValue = primalEntry;
@@ -536,6 +558,8 @@ namespace codi {
           primal = Real();
         }
 
+        primalSchedule.clear();
+
         Base::reset(resetAdjoints, adjointsManagement);
       }
 
@@ -629,6 +653,8 @@ namespace codi {
       /// Internal method for the forward evaluation of the whole tape.
       template<bool copyPrimal, typename Adjoint>
       CODI_NO_INLINE void internalEvaluateForward(Position const& start, Position const& end, Adjoint* data) {
+        cast().internalCheckPrimalValuesAvailable();
+
         std::vector<Real> primalsCopy(0);
         Real* primalData = primals.data();
 
@@ -644,6 +670,8 @@ namespace codi {
         EventSystem<Impl>::notifyTapeEvaluateListeners(
             cast(), start, end, &vectorAccess, EventHints::EvaluationKind::Forward, EventHints::Endpoint::Begin);
 
+        invalidateOverwrittenPrimalCheckpoint();
+
         Wrap_internalEvaluateForward_EvalStatements evalFunc{};
         Base::llfByteData.evaluateForward(start, end, evalFunc, cast(), primalData, dataVector);
 
@@ -677,6 +705,8 @@ namespace codi {
       /// Internal method for the reverse evaluation of the whole tape.
       template<bool copyPrimal, typename Adjoint>
       CODI_INLINE void internalEvaluateReverse(Position const& start, Position const& end, Adjoint* data) {
+        cast().internalCheckPrimalValuesAvailable();
+
         Real* primalData = primals.data();
 
         if (copyPrimal) {
@@ -730,6 +760,10 @@ namespace codi {
         std::swap(adjoints, other.adjoints);
         std::swap(primals, other.primals);
 
+        // Schedules point into the data streams, which are swapped.
+        primalSchedule.clear();
+        other.primalSchedule.clear();
+
         Base::swap(other);
 
         // Ensure that the primals vector of both tapes are sized according to the index manager.
@@ -737,6 +771,34 @@ namespace codi {
         other.checkPrimalSize(true);
       }
 
+      /// \copydoc codi::DataManagementTapeInterface::resetHard()
+      void resetHard() {
+        primalSchedule.clear();
+
+        Base::resetHard();
+      }
+
+      /// \copydoc codi::DataManagementTapeInterface::readFromFile()
+      void readFromFile(std::string const& filename, FileIoOptions const& options = FileIoOptions()) {
+        primalSchedule.clear();
+
+        Base::readFromFile(filename, options);
+      }
+
+      /// \copydoc codi::DataManagementTapeInterface::readCheckpointsFromFile()
+      void readCheckpointsFromFile(std::string const& filename) {
+        primalSchedule.clear();
+
+        Base::readCheckpointsFromFile(filename);
+      }
+
+      /// \copydoc codi::DataManagementTapeInterface::deleteData()
+      void deleteData() {
+        primalSchedule.clear();
+
+        Base::deleteData();
+      }
+
       /// \copydoc codi::DataManagementTapeInterface::deleteAdjointVector()
       void deleteAdjointVector() {
         adjoints.resize(1);
@@ -803,6 +865,7 @@ namespace codi {
             rhsIdentiferData.resize(value);
             break;
           case TapeParameters::PrimalSize:
+            cast().internalCheckPrimalValuesAvailable();
             primals.resize(value);
             break;
           case TapeParameters::StatementSize:
@@ -821,6 +884,8 @@ namespace codi {
       /// \copydoc codi::DataManagementTapeInterface::createVectorAccessCustomAdjoints()
       template<typename Adjoint>
       VectorAccess<Adjoint>* createVectorAccessCustomAdjoints(Adjoint* data) {
+        cast().internalCheckPrimalValuesAvailable();
+
         return new VectorAccess<Adjoint>(data, primals.data());
       }
 
@@ -1028,7 +1093,9 @@ namespace codi {
         rhsIdentiferData.reserveItems(size);
         passiveValueData.reserveItems(size);
 
-        indexManager.get().template assignIndex<Impl>(lhsIndex);
+        bool generatedNewIndex = indexManager.get().template assignIndex<Impl>(lhsIndex);
+        checkPrimalSize(generatedNewIndex);
+
         Real& primalEntry = primals[lhsIndex];
         cast().pushStmtData(lhsIndex, size, primalEntry, PrimalValueBaseTape::jacobianExpressions[size]);
 
@@ -1044,6 +1111,8 @@ namespace codi {
 
       /// @copydoc LowLevelFunctionTapeInterface::pushLowLevelFunction
       CODI_INLINE void pushLowLevelFunction(Config::LowLevelFunctionToken token, size_t size, ByteDataView& data) {
+        cast().internalCheckPrimalValuesAvailable();
+
         statementData.reserveItems(1);
 
         Base::internalStoreLowLevelFunction(token, size, data);
@@ -1071,7 +1140,7 @@ namespace codi {
 
         codiAssert(indexManager.get().getLargestCreatedIndex() < (Identifier)adjoints.size());
 
-        evaluate(start, end, adjoints.data());
+        cast().evaluate(start, end, adjoints.data());
       }
 
       /// \copydoc codi::PositionalEvaluationTapeInterface::resetTo(T_Position const&, bool, AdjointsManagement)
@@ -1081,6 +1150,8 @@ namespace codi {
                                AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
         cast().internalResetPrimalValues(pos);
 
+        primalSchedule.clear();
+
         Base::resetTo(pos, resetAdjoints, adjointsManagement);
       }
 
@@ -1134,6 +1205,10 @@ namespace codi {
       /// Wrapper helper for improved compiler optimizations.
       CODI_WRAP_FUNCTION(Wrap_internalEvaluatePrimal_EvalStatements, Impl::internalEvaluatePrimal_EvalStatements);
 
+      /// Wrapper helper for improved compiler optimizations.
+      CODI_WRAP_FUNCTION(Wrap_internalEvaluatePrimalBuildSchedule_EvalStatements,
+                         Impl::internalEvaluatePrimalBuildSchedule_EvalStatements);
+
     public:
 
       /// @}
@@ -1145,12 +1220,16 @@ namespace codi {
 
       /// \copydoc codi::PrimalEvaluationTapeInterface::evaluatePrimal()
       CODI_NO_INLINE void evaluatePrimal(Position const& start, Position const& end) {
+        cast().internalCheckPrimalValuesAvailable();
+
         // TODO: implement primal value only accessor
         PrimalAdjointVectorAccess<Real, Identifier, Gradient> primalAdjointAccess(adjoints.data(), primals.data());
 
         EventSystem<Impl>::notifyTapeEvaluateListeners(cast(), start, end, &primalAdjointAccess,
                                                        EventHints::EvaluationKind::Primal, EventHints::Endpoint::Begin);
 
+        invalidateOverwrittenPrimalCheckpoint();
+
         Wrap_internalEvaluatePrimal_EvalStatements evalFunc{};
         Base::llfByteData.evaluateForward(start, end, evalFunc, cast(), primals.data());
 
@@ -1160,14 +1239,185 @@ namespace codi {
 
       /// \copydoc codi::PrimalEvaluationTapeInterface::primal(T_Identifier const&)
       Real& primal(Identifier const& identifier) {
+        cast().internalCheckPrimalValuesAvailable();
+
         return primals[identifier];
       }
 
       /// \copydoc codi::PrimalEvaluationTapeInterface::primal(T_Identifier const&) const
       Real const& primal(Identifier const& identifier) const {
+        cast().internalCheckPrimalValuesAvailable();
+
         return primals[identifier];
       }
 
+      /// @}
+      /*******************************************************************************/
+      /// @name Thread-parallel primal and forward evaluation
+      /// @{
+
+      /**
+       * @brief Level-scheduled primal evaluation. Same result as evaluatePrimal().
+       *
+       * The first call for a range evaluates the tape serially and builds a PrimalEvaluationSchedule. Subsequent calls
+       * for the same range evaluate the statements of each level in parallel, if OpenMP is enabled in the compiler.
+       * The schedule is discarded when the tape is reset or swapped. It is not updated if further statements are
+       * recorded in the range, call clearPrimalSchedule() in this case.
+       *
+       * Statement listeners of the event system may be called concurrently.
+       */
+      void evaluatePrimalParallel(Position const& start, Position const& end) {
+        cast().internalCheckPrimalValuesAvailable();
+
+        PrimalAdjointVectorAccess<Real, Identifier, Gradient> primalAdjointAccess(adjoints.data(), primals.data());
+
+        EventSystem<Impl>::notifyTapeEvaluateListeners(cast(), start, end, &primalAdjointAccess,
+                                                       EventHints::EvaluationKind::Primal, EventHints::Endpoint::Begin);
+
+        invalidateOverwrittenPrimalCheckpoint();
+
+        if (primalSchedule.isBuiltFor(start, end)) {
+          Impl& tape = cast();
+          Real* primalVector = primals.data();
+          VectorAccess<Gradient> vectorAccess(nullptr, primalVector);
+
+          primalSchedule.evaluate(
+              [&](typename PrimalSchedule::Statement const& stmt) {
+                size_t curConstantPos = 0;
+                size_t curPassivePos = 0;
+                size_t curRhsIdentifiersPos = 0;
+
+                if (nullptr != stmt.oldPrimalValue) {
+                  *stmt.oldPrimalValue = primalVector[stmt.lhs];
+                }
+                primalVector[stmt.lhs] = StatementEvaluator::template callPrimal<Impl>(
+                    stmt.evalHandle, primalVector, stmt.numberOfPassiveArguments, curConstantPos, stmt.constantValues,
+                    curPassivePos, stmt.passiveValues, curRhsIdentifiersPos, stmt.rhsIdentifiers);
+
+                EventSystem<Impl>::notifyStatementEvaluatePrimalListeners(tape, stmt.lhs, primalVector[stmt.lhs]);
+              },
+              [&](typename PrimalSchedule::LowLevelFunction const& llf) {
+                size_t curLLFByteDataPos = llf.byteDataPos;
+                size_t curLLFInfoDataPos = llf.infoDataPos;
+                Base::template callLowLevelFunction<LowLevelFunctionEntryCallKind::Primal>(
+                    tape, true, curLLFByteDataPos, llf.dataPtr, curLLFInfoDataPos, llf.tokenPtr, llf.dataSizePtr,
+                    &vectorAccess);
+              });
+        } else {
+          primalSchedule.reset(start, end);
+
+          Wrap_internalEvaluatePrimalBuildSchedule_EvalStatements evalFunc{};
+          Base::llfByteData.evaluateForward(start, end, evalFunc, cast(), primals.data(), primalSchedule);
+
+          primalSchedule.finalize();
+        }
+
+        EventSystem<Impl>::notifyTapeEvaluateListeners(cast(), start, end, &primalAdjointAccess,
+                                                       EventHints::EvaluationKind::Primal, EventHints::Endpoint::End);
+      }
+
+      /// Level-scheduled primal evaluation of the whole tape. See evaluatePrimalParallel(Position const&,
+      /// Position const&).
+      void evaluatePrimalParallel() {
+        evaluatePrimalParallel(cast().getZeroPosition(), cast().getPosition());
+      }
+
+      /**
+       * @brief Level-scheduled forward evaluation. Same result as evaluateForward().
+       *
+       * Uses the schedule that was built by evaluatePrimalParallel() for the same range. Without such a schedule, or if
+       * Config::VariableAdjointInterfaceInPrimalTapes is enabled, the regular serial forward evaluation is performed.
+       *
+       * Statement listeners of the event system may be called concurrently.
+       */
+      void evaluateForwardParallel(Position const& start, Position const& end,
+                                   AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+#if CODI_VariableAdjointInterfaceInPrimalTapes
+        cast().evaluateForward(start, end, adjointsManagement);
+#else
+        if (!primalSchedule.isBuiltFor(start, end)) {
+          cast().evaluateForward(start, end, adjointsManagement);
+          return;
+        }
+
+        if (AdjointsManagement::Automatic == adjointsManagement) {
+          checkAdjointSize(indexManager.get().getLargestCreatedIndex());
+        }
+
+        codiAssert(indexManager.get().getLargestCreatedIndex() < (Identifier)adjoints.size());
+
+        cast().internalCheckPrimalValuesAvailable();
+
+        std::vector<Real> primalsCopy(0);
+        Real* primalVector = primals.data();
+
+        if (!TapeTypes::IsLinearIndexHandler) {
+          primalsCopy = primals;
+          primalVector = primalsCopy.data();
+        }
+
+        invalidateOverwrittenPrimalCheckpoint();
+
+        Impl& tape = cast();
+        Gradient* adjointVector = adjoints.data();
+        VectorAccess<Gradient> vectorAccess(adjointVector, primalVector);
+
+        EventSystem<Impl>::notifyTapeEvaluateListeners(
+            cast(), start, end, &vectorAccess, EventHints::EvaluationKind::Forward, EventHints::Endpoint::Begin);
+
+        primalSchedule.evaluate(
+            [&](typename PrimalSchedule::Statement const& stmt) {
+              size_t curConstantPos = 0;
+              size_t curPassivePos = 0;
+              size_t curRhsIdentifiersPos = 0;
+
+              Gradient lhsTangent = Gradient();
+
+              if (nullptr != stmt.oldPrimalValue) {
+                *stmt.oldPrimalValue = primalVector[stmt.lhs];
+              }
+              primalVector[stmt.lhs] = StatementEvaluator::template callForward<Impl>(
+                  stmt.evalHandle, primalVector, adjointVector, lhsTangent, stmt.numberOfPassiveArguments,
+                  curConstantPos, stmt.constantValues, curPassivePos, stmt.passiveValues, curRhsIdentifiersPos,
+                  stmt.rhsIdentifiers);
+
+              adjointVector[stmt.lhs] = lhsTangent;
+
+              if (Config::StatementEvents) {
+                EventSystem<Impl>::notifyStatementEvaluateListeners(tape, stmt.lhs, GradientTraits::dim<Gradient>(),
+                                                                    GradientTraits::toArray(lhsTangent).data());
+              }
+              EventSystem<Impl>::notifyStatementEvaluatePrimalListeners(tape, stmt.lhs, primalVector[stmt.lhs]);
+            },
+            [&](typename PrimalSchedule::LowLevelFunction const& llf) {
+              size_t curLLFByteDataPos = llf.byteDataPos;
+              size_t curLLFInfoDataPos = llf.infoDataPos;
+              Base::template callLowLevelFunction<LowLevelFunctionEntryCallKind::Forward>(
+                  tape, true, curLLFByteDataPos, llf.dataPtr, curLLFInfoDataPos, llf.tokenPtr, llf.dataSizePtr,
+                  &vectorAccess);
+            });
+
+        EventSystem<Impl>::notifyTapeEvaluateListeners(cast(), start, end, &vectorAccess,
+                                                       EventHints::EvaluationKind::Forward, EventHints::Endpoint::End);
+#endif
+      }
+
+      /// Level-scheduled forward evaluation of the whole tape. See evaluateForwardParallel(Position const&,
+      /// Position const&, AdjointsManagement).
+      void evaluateForwardParallel(AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        evaluateForwardParallel(cast().getZeroPosition(), cast().getPosition(), adjointsManagement);
+      }
+
+      /// Discard the schedule of evaluatePrimalParallel(). It is rebuilt on the next call.
+      void clearPrimalSchedule() {
+        primalSchedule.clear();
+      }
+
+      /// Access the schedule of evaluatePrimalParallel(), e.g. for statistics.
+      PrimalSchedule const& getPrimalSchedule() const {
+        return primalSchedule;
+      }
+
       /// @}
       /*******************************************************************************/
       /// @name Function from StatementEvaluatorInnerTapeInterface
@@ -1355,18 +1605,33 @@ namespace codi {
         }
       }
 
+    protected:
+
+      /// Resize the primal vector if a new index was generated that is not covered.
       CODI_INLINE void checkPrimalSize(bool generatedNewIndex) {
         if (generatedNewIndex && indexManager.get().getLargestCreatedIndex() >= (Identifier)primals.size()) {
           resizePrimalVector();
         }
       }
 
+    private:
+
+      /// Primal and forward evaluations of reuse index tapes update the overwritten primal values in the statement
+      /// data. These in place modifications are not tracked by the checkpoints.
+      void invalidateOverwrittenPrimalCheckpoint() {
+        if (!TapeTypes::IsLinearIndexHandler) {
+          statementData.invalidateCheckpoint(false);
+        }
+      }
+
       CODI_NO_INLINE void resizeAdjointsVector() {
         // overallocate as next multiple of Config::ChunkSize
         adjoints.resize(getNextMultiple((size_t)indexManager.get().getLargestCreatedIndex() + 1, Config::ChunkSize));
       }
 
       CODI_NO_INLINE void resizePrimalVector() {
+        cast().internalCheckPrimalValuesAvailable();
+
         // overallocate as next multiple of Config::ChunkSize
         primals.resize(getNextMultiple((size_t)indexManager.get().getLargestCreatedIndex() + 1, Config::ChunkSize));
       }
@@ -35,19 +35,28 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
+#include <map>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "../config.h"
 #include "../expressions/lhsExpressionInterface.hpp"
 #include "../expressions/logic/compileTimeTraversalLogic.hpp"
 #include "../expressions/logic/constructStaticContext.hpp"
 #include "../expressions/logic/traversalLogic.hpp"
+#include "../misc/fileIo.hpp"
 #include "../misc/macros.hpp"
 #include "../misc/memberStore.hpp"
 #include "../traits/expressionTraits.hpp"
 #include "data/chunk.hpp"
 #include "indices/indexManagerInterface.hpp"
+#include "misc/statementHandleRegistry.hpp"
 #include "primalValueBaseTape.hpp"
 
 /** \copydoc codi::Namespace */
@@ -58,6 +67,24 @@ namespace codi {
    *
    * This class implements the interface methods from the PrimalValueBaseTape.
    *
+   * \section releasedPrimals Released primal values
+   * The primal value vector has an entry for each identifier of the recording. For long recordings,
+   * releasePrimalValues() frees this vector after the recording. Only the primal values of inputs and of arguments
+   * that are used in a later window of the tape are kept. A window is the range of statements between two chunk
+   * boundaries of the data streams, its size is controlled by Config::ChunkSize. A reverse evaluation then processes
+   * the tape window by window: The primal values of the window are recomputed in a buffer of window size and the
+   * statements are reversed with a local adjoint buffer. The recomputation costs about one primal evaluation.
+   *
+   * Only the memory after the recording is reduced. The full primal value vector is required during the recording
+   * and again by restorePrimalValues().
+   *
+   * While the primal values are released, reverse evaluations with evaluate() have to end at the zero position of the
+   * tape. Recording, low level functions, primal and forward evaluations, evaluateKeepState(), primal value access and
+   * vector access objects are not available and result in a CODI_EXCEPTION. The statement evaluator has to support
+   * primal evaluations, i.e. the ReverseStatementEvaluator can not be used. restorePrimalValues() recomputes the full
+   * primal value vector, it is called automatically by resetTo(). reset() discards the released values without
+   * allocating the primal value vector again, it is allocated by the next recording.
+   *
    * @tparam T_TapeTypes  JacobianTapeTypes definition.
    */
   template<typename T_TapeTypes>
@@ -82,9 +109,11 @@ namespace codi {
       using Position = typename Base::Position;                           ///< See TapeTypesInterface.
 
       /// Constructor
-      PrimalValueLinearTape() : Base() {}
+      PrimalValueLinearTape()
+          : Base(), primalsReleased(false), releasedPrimalIdentifiers(0), releasedPrimalValues(0), releasedWindows(0) {}
 
       using Base::clearAdjoints;
+      using Base::evaluate;
 
       /// \copydoc codi::PositionalEvaluationTapeInterface::clearAdjoints
       /// <br> Implementation: Automatic adjoints management has no effect. Primal value tapes do not implement adjoints
@@ -105,6 +134,54 @@ namespace codi {
         }
       }
 
+      /// \copydoc codi::CustomAdjointVectorEvaluationTapeInterface::evaluate()
+      /// <br> Implementation: Evaluates window by window if the primal values are released, see \ref releasedPrimals.
+      template<typename Adjoint>
+      CODI_INLINE void evaluate(Position const& start, Position const& end, Adjoint* data) {
+        if (primalsReleased) CODI_Unlikely {
+          evaluateReleased(start, end, data);
+        } else CODI_Likely {
+          Base::evaluate(start, end, data);
+        }
+      }
+
+      /// \copydoc codi::ReverseTapeInterface::reset()
+      /// <br> Implementation: Released primal values are discarded, the primal value vector is allocated by the next
+      /// recording.
+      CODI_INLINE void reset(bool resetAdjoints = true,
+                             AdjointsManagement adjointsManagement = AdjointsManagement::Automatic) {
+        if (primalsReleased) CODI_Unlikely {
+          discardReleasedPrimals();
+        }
+
+        Base::reset(resetAdjoints, adjointsManagement);
+      }
+
+      /// \copydoc codi::DataManagementTapeInterface::swap()
+      void swap(PrimalValueLinearTape& other) {
+        bool const released = primalsReleased;
+        bool const otherReleased = other.primalsReleased;
+
+        // The base class resizes the primal value vectors, which is not allowed while they are released.
+        primalsReleased = false;
+        other.primalsReleased = false;
+
+        Base::swap(other);
+
+        primalsReleased = otherReleased;
+        other.primalsReleased = released;
+        std::swap(releasedPrimalIdentifiers, other.releasedPrimalIdentifiers);
+        std::swap(releasedPrimalValues, other.releasedPrimalValues);
+        std::swap(releasedWindows, other.releasedWindows);
+
+        if (primalsReleased) {
+          std::vector<Real>().swap(Base::primals);
+        }
+        if (other.primalsReleased) {
+          std::vector<Real>().swap(other.primals);
+        }
+      }
+
     protected:
 
       /// \copydoc codi::PrimalValueBaseTape::internalEvaluateForward_EvalStatements
@@ -166,8 +243,10 @@ namespace codi {
 #else
             adjointVector[curAdjointPos] = lhsTangent;
 
-            EventSystem<PrimalValueLinearTape>::notifyStatementEvaluateListeners(
-                tape, curAdjointPos, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsTangent).data());
+            if (Config::StatementEvents) {
+              EventSystem<PrimalValueLinearTape>::notifyStatementEvaluateListeners(
+                  tape, curAdjointPos, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsTangent).data());
+            }
 #endif
             EventSystem<PrimalValueLinearTape>::notifyStatementEvaluatePrimalListeners(tape, curAdjointPos,
                                                                                        primalVector[curAdjointPos]);
@@ -227,6 +306,68 @@ namespace codi {
         }
       }
 
+      /// \copydoc codi::PrimalValueBaseTape::internalEvaluatePrimalBuildSchedule_EvalStatements
+      CODI_INLINE static void internalEvaluatePrimalBuildSchedule_EvalStatements(
+          /* data from call */
+          PrimalValueLinearTape& tape, Real* primalVector, typename Base::PrimalSchedule& schedule,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from constantValueData */
+          size_t& curConstantPos, size_t const& endConstantPos, PassiveReal const* const constantValues,
+          /* data from passiveValueData */
+          size_t& curPassivePos, size_t const& endPassivePos, Real const* const passiveValues,
+          /* data from rhsIdentifiersData */
+          size_t& curRhsIdentifiersPos, size_t const& endRhsIdentifiersPos, Identifier const* const rhsIdentifiers,
+          /* data from statementData */
+          size_t& curStatementPos, size_t const& endStatementPos,
+          Config::ArgumentSize const* const numberOfPassiveArguments, EvalHandle const* const stmtEvalhandle,
+          /* data from index handler */
+          size_t const& startAdjointPos, size_t const& endAdjointPos) {
+        CODI_UNUSED(endLLFByteDataPos, endLLFInfoDataPos, endConstantPos, endPassivePos, endRhsIdentifiersPos,
+                    endStatementPos);
+
+        size_t curAdjointPos = startAdjointPos;
+
+        typename Base::template VectorAccess<Gradient> vectorAccess(nullptr, primalVector);
+
+        while (curAdjointPos < endAdjointPos) CODI_Likely {
+          curAdjointPos += 1;
+
+          Config::ArgumentSize nPassiveValues = numberOfPassiveArguments[curStatementPos];
+
+          if (Config::StatementLowLevelFunctionTag == nPassiveValues) CODI_Unlikely {
+            schedule.pushLowLevelFunction(dataPtr, curLLFByteDataPos, tokenPtr, dataSizePtr, curLLFInfoDataPos);
+
+            Base::template callLowLevelFunction<LowLevelFunctionEntryCallKind::Primal>(
+                tape, true, curLLFByteDataPos, dataPtr, curLLFInfoDataPos, tokenPtr, dataSizePtr, &vectorAccess);
+          } else if (Config::StatementInputTag == nPassiveValues) CODI_Unlikely {
+            // Do nothing.
+          } else CODI_Likely {
+            size_t const stmtConstantPos = curConstantPos;
+            size_t const stmtPassivePos = curPassivePos;
+            size_t const stmtRhsIdentifiersPos = curRhsIdentifiersPos;
+
+            primalVector[curAdjointPos] = StatementEvaluator::template callPrimal<PrimalValueLinearTape>(
+                stmtEvalhandle[curStatementPos], primalVector, nPassiveValues, curConstantPos, constantValues,
+                curPassivePos, passiveValues, curRhsIdentifiersPos, rhsIdentifiers);
+
+            schedule.pushStatement(curAdjointPos, nPassiveValues, stmtEvalhandle[curStatementPos],
+                                   &constantValues[stmtConstantPos], &passiveValues[stmtPassivePos],
+                                   &rhsIdentifiers[stmtRhsIdentifiersPos],
+                                   curRhsIdentifiersPos - stmtRhsIdentifiersPos,
+                                   nullptr);
+
+            EventSystem<PrimalValueLinearTape>::notifyStatementEvaluatePrimalListeners(tape, curAdjointPos,
+                                                                                       primalVector[curAdjointPos]);
+          }
+
+          curStatementPos += 1;
+        }
+      }
+
       /// \copydoc codi::PrimalValueBaseTape::internalEvaluateReverse_EvalStatements
       CODI_INLINE static void internalEvaluateReverse_EvalStatements(
           /* data from call */
@@ -283,8 +424,10 @@ namespace codi {
 #else
             Gradient const lhsAdjoint = adjointVector[curAdjointPos];
 
-            EventSystem<PrimalValueLinearTape>::notifyStatementEvaluateListeners(
-                tape, curAdjointPos, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsAdjoint).data());
+            if (Config::StatementEvents) {
+              EventSystem<PrimalValueLinearTape>::notifyStatementEvaluateListeners(
+                  tape, curAdjointPos, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsAdjoint).data());
+            }
 
             if (Config::ReversalZeroesAdjoints) {
               adjointVector[curAdjointPos] = Gradient();
@@ -302,12 +445,21 @@ namespace codi {
         }
       }
 
+      /// \copydoc codi::PrimalValueBaseTape::internalCheckPrimalValuesAvailable
+      CODI_INLINE void internalCheckPrimalValuesAvailable() const {
+        if (primalsReleased) CODI_Unlikely {
+          CODI_EXCEPTION("The primal values are released, call restorePrimalValues() first.");
+        }
+      }
+
       /// \copydoc codi::PrimalValueBaseTape::internalResetPrimalValues
-      /// Empty implementation; primal values are not overwritten with linear index management.
+      /// Primal values are not overwritten with linear index management. Released primal values are restored.
       CODI_INLINE void internalResetPrimalValues(Position const& pos) {
         CODI_UNUSED(pos);
 
-        // Nothing to do.
+        if (primalsReleased) CODI_Unlikely {
+          restorePrimalValues();
+        }
       }
 
       /// \copydoc codi::PrimalValueBaseTape::pushStmtData
@@ -327,5 +479,709 @@ namespace codi {
 
         // Primal values do not need to be reset.
       }
+
+#if CODI_PortableTapeFiles
+      /*******************************************************************************/
+      /// @name Portable file IO
+      /// @{
+
+      /**
+       * @brief Write the recording to a file that can be read by other processes of the same build.
+       *
+       * In contrast to writeToFile(), the chunk layout and the primal value vector are stored and the statement
+       * evaluation handles are replaced by the stable identifiers of the StatementHandleRegistry. The file header
+       * contains fingerprints of the tape type and the configuration, which are checked by readFromPortableFile().
+       *
+       * The whole recording from the zero position to the current position is written. Low level functions can not be
+       * stored and result in an exception.
+       *
+       * The statements are written in blocks, one per chunk of the recording. Each block stores the statement data and
+       * the argument data as contiguous arrays.
+       */
+      void writeToPortableFile(std::string const& filename) {
+        registerJacobianHandles();
+        restorePrimalValues();
+
+        if (0 != Base::llfInfoData.getDataSize()) {
+          CODI_EXCEPTION("Tapes with low level functions can not be written to portable files.");
+        }
+
+        PortableHandleTable table;
+        auto collectFunc = [&table](Config::ArgumentSize* numberOfPassiveArguments, EvalHandle* evalHandle) {
+          CODI_UNUSED(numberOfPassiveArguments);
+
+          table.addHandle(*evalHandle);
+        };
+        Base::statementData.forEachForward(Base::statementData.getZeroPosition(), Base::statementData.getPosition(),
+                                           collectFunc);
+
+        FileIo io(filename, true);
+
+        writePortableHeader(io);
+
+        uint64_t handleCount = table.ids.size();
+        io.writeData(&handleCount, 1);
+        io.writeData(table.ids.data(), table.ids.size());
+
+        uint64_t statementCount = Base::statementData.getDataSize();
+        io.writeData(&statementCount, 1);
+
+        Wrap_internalWritePortable_Statements writeFunc{};
+        Base::llfByteData.evaluateForward(this->getZeroPosition(), this->getPosition(), writeFunc, io, table);
+
+        uint64_t primalCount = (uint64_t)Base::indexManager.get().getLargestCreatedIndex() + 1;
+        io.writeData(&primalCount, 1);
+        io.writeData(Base::primals.data(), primalCount);
+      }
+
+      /**
+       * @brief Replace the recording with the one stored by writeToPortableFile().
+       *
+       * The tape is reset and the statements of the file are recorded again with the evaluation handles of this
+       * process. The identifiers of the stored statements are the same as in the writing process, so the identifiers
+       * of inputs and outputs can be stored alongside the tape file.
+       *
+       * The argument data of a block is read directly into the chunks of the tape. Since the chunk sizes are part of
+       * the configuration fingerprint, every block fits into one chunk of each data stream.
+       */
+      void readFromPortableFile(std::string const& filename) {
+        registerJacobianHandles();
+
+        FileIo io(filename, false);
+
+        readPortableHeader(io);
+
+        uint64_t handleCount = 0;
+        io.readData(&handleCount, 1);
+
+        std::vector<typename Registry::Id> ids(handleCount);
+        io.readData(ids.data(), handleCount);
+
+        std::vector<typename Registry::Entry const*> entries(handleCount);
+        for (size_t i = 0; i < handleCount; ++i) {
+          entries[i] = Registry::getInstance().find(ids[i]);
+          if (nullptr == entries[i]) {
+            CODI_EXCEPTION("Statement handle %llu of the tape file is not known in this program.",
+                           (unsigned long long)ids[i]);
+          }
+        }
+
+        reset();
+
+        uint64_t statementCount = 0;
+        io.readData(&statementCount, 1);
+
+        std::vector<Config::ArgumentSize> numberOfPassiveArguments;
+        std::vector<uint32_t> handleIndices;
+        uint64_t readStatements = 0;
+        while (readStatements < statementCount) {
+          PortableBlockHeader header;
+          io.readData(&header, 1);
+
+          size_t const argumentChunkSize = std::max(Config::ChunkSize, Config::MaxArgumentSize);
+          if (0 == header.statements || header.statements > Config::ChunkSize ||
+              header.statements > statementCount - readStatements || header.activeArguments > argumentChunkSize ||
+              header.passiveArguments > argumentChunkSize || header.constantArguments > argumentChunkSize) {
+            CODI_EXCEPTION("Invalid statement block in tape file.");
+          }
+
+          numberOfPassiveArguments.resize(header.statements);
+          handleIndices.resize(header.statements);
+          io.readData(numberOfPassiveArguments.data(), header.statements);
+          io.readData(handleIndices.data(), header.statements);
+
+          // Validate the block before the argument data is added to the tape.
+          PortableBlockHeader expected = {header.statements, 0, 0, 0};
+          for (size_t i = 0; i < header.statements; ++i) {
+            if (handleIndices[i] >= handleCount) {
+              CODI_EXCEPTION("Invalid statement handle index in tape file.");
+            }
+            if (Config::StatementInputTag != numberOfPassiveArguments[i]) {
+              expected.activeArguments += entries[handleIndices[i]]->activeArguments;
+              expected.passiveArguments += numberOfPassiveArguments[i];
+              expected.constantArguments += entries[handleIndices[i]]->constantArguments;
+            }
+          }
+          if (expected.activeArguments != header.activeArguments ||
+              expected.passiveArguments != header.passiveArguments ||
+              expected.constantArguments != header.constantArguments) {
+            CODI_EXCEPTION("Argument counts of a statement block in the tape file do not match the statements.");
+          }
+
+          // All data is reserved before any data is added, as in PrimalValueBaseTape::store. A new chunk stores the
+          // position of the nested data, which has to be the position before the block.
+          Base::statementData.reserveItems(header.statements);
+          Base::rhsIdentiferData.reserveItems(header.activeArguments);
+          Base::passiveValueData.reserveItems(header.passiveArguments);
+          Base::constantValueData.reserveItems(header.constantArguments);
+
+          readPortableData<Identifier>(io, Base::rhsIdentiferData, header.activeArguments);
+          readPortableData<Real>(io, Base::passiveValueData, header.passiveArguments);
+          readPortableData<PassiveReal>(io, Base::constantValueData, header.constantArguments);
+
+          for (size_t i = 0; i < header.statements; ++i) {
+            Identifier lhsIdentifier = IndexManager::InactiveIndex;
+            Base::indexManager.get().template assignIndex<PrimalValueLinearTape>(lhsIdentifier);
+            Base::checkPrimalSize(true);
+
+            pushStmtData(lhsIdentifier, numberOfPassiveArguments[i], Base::primals[lhsIdentifier],
+                         entries[handleIndices[i]]->handle);
+          }
+
+          readStatements += header.statements;
+        }
+
+        uint64_t primalCount = 0;
+        io.readData(&primalCount, 1);
+        if (primalCount != (uint64_t)Base::indexManager.get().getLargestCreatedIndex() + 1) {
+          CODI_EXCEPTION("Number of primal values in tape file does not match the statements.");
+        }
+        Base::checkPrimalSize(true);
+        io.readData(Base::primals.data(), primalCount);
+      }
+
+      /// @}
+
+    private:
+
+      using Registry = StatementHandleRegistry<EvalHandle>;
+
+      static uint64_t constexpr PortableFileVersion = 2;
+
+      /// Sizes of one block of statements in a portable file.
+      struct PortableBlockHeader {
+        public:
+          uint64_t statements;
+          uint64_t activeArguments;
+          uint64_t passiveArguments;
+          uint64_t constantArguments;
+      };
+
+      /// Handles of a recording with their index in the file.
+      struct PortableHandleTable {
+        public:
+          std::map<EvalHandle, uint32_t> indices;
+          std::vector<typename Registry::Id> ids;
+          std::vector<typename Registry::Entry const*> entries;
+
+          void addHandle(EvalHandle const& handle) {
+            if (indices.end() == indices.find(handle)) {
+              typename Registry::Id id;
+              if (!Registry::getInstance().getId(handle, id)) {
+                CODI_EXCEPTION("Statement handle is not registered. It can not be written to a portable file.");
+              }
+
+              indices[handle] = (uint32_t)ids.size();
+              ids.push_back(id);
+              entries.push_back(Registry::getInstance().find(id));
+            }
+          }
+      };
+
+      /// The handles of manual statement pushes are created in a static array and registered on demand.
+      static void registerJacobianHandles() {
+        typename Registry::Id tapeId = Registry::hash(typeid(PrimalValueLinearTape).name());
+        tapeId = Registry::hash("JacobianStatement", tapeId);
+        for (size_t size = 0; size < Config::MaxArgumentSize; ++size) {
+          Registry::getInstance().add(Registry::hash(std::to_string(size).c_str(), tapeId),
+                                      Base::jacobianExpressions[size], size, 0);
+        }
+      }
+
+      /// Covers the binary layout of all stored data: type names and sizes, the floating point format, the byte order
+      /// and the chunk sizes.
+      static typename Registry::Id getConfigFingerprint() {
+        uint32_t const byteOrderProbe = 0x01020304;
+        unsigned char byteOrder[sizeof(uint32_t)];
+        std::memcpy(byteOrder, &byteOrderProbe, sizeof(uint32_t));
+
+        std::string config = std::to_string(sizeof(Real)) + "," + std::to_string(sizeof(PassiveReal)) + "," +
+                             std::to_string(sizeof(Identifier)) + "," + std::to_string(sizeof(Config::ArgumentSize)) +
+                             "," + std::to_string(Config::MaxArgumentSize) + "," +
+                             std::to_string(Config::StatementInputTag) + "," +
+                             std::to_string(Config::StatementLowLevelFunctionTag) + "," +
+                             std::to_string(Config::ChunkSize) + "," + std::to_string(byteOrder[0]) + "," +
+                             std::to_string(std::numeric_limits<PassiveReal>::digits) + "," +
+                             std::to_string(std::numeric_limits<PassiveReal>::max_exponent) + "," +
+                             std::to_string(std::numeric_limits<PassiveReal>::is_iec559);
+
+        typename Registry::Id fingerprint = Registry::hash(config.c_str());
+        fingerprint = Registry::hash(typeid(Real).name(), fingerprint);
+        fingerprint = Registry::hash(typeid(PassiveReal).name(), fingerprint);
+        fingerprint = Registry::hash(typeid(Identifier).name(), fingerprint);
+
+        return fingerprint;
+      }
+
+      static void writePortableHeader(FileIo& io) {
+        char magic[8] = {'C', 'o', 'D', 'i', 'T', 'a', 'p', 'e'};
+        uint64_t version = PortableFileVersion;
+        typename Registry::Id tapeFingerprint = Registry::hash(typeid(PrimalValueLinearTape).name());
+        typename Registry::Id configFingerprint = getConfigFingerprint();
+
+        io.writeData(magic, 8);
+        io.writeData(&version, 1);
+        io.writeData(&tapeFingerprint, 1);
+        io.writeData(&configFingerprint, 1);
+      }
+
+      static void readPortableHeader(FileIo& io) {
+        char magic[8];
+        uint64_t version;
+        typename Registry::Id tapeFingerprint;
+        typename Registry::Id configFingerprint;
+
+        io.readData(magic, 8);
+        io.readData(&version, 1);
+        io.readData(&tapeFingerprint, 1);
+        io.readData(&configFingerprint, 1);
+
+        if (0 != std::memcmp(magic, "CoDiTape", 8) || PortableFileVersion != version) {
+          CODI_EXCEPTION("File is not a portable CoDiPack tape file.");
+        }
+        if (Registry::hash(typeid(PrimalValueLinearTape).name()) != tapeFingerprint) {
+          CODI_EXCEPTION("Tape file was written by a different tape type.");
+        }
+        if (getConfigFingerprint() != configFingerprint) {
+          CODI_EXCEPTION("Tape file was written with a different configuration.");
+        }
+      }
+
+      /// Reads count items into data. The items have to be reserved.
+      template<typename Item, typename Data>
+      static void readPortableData(FileIo& io, Data& data, size_t count) {
+        if (0 != count) {
+          Item* pointer;
+          data.getDataPointers(pointer);
+          io.readData(pointer, count);
+          data.addDataSize(count);
+        }
+      }
+
+      /// Writes the statements of one chunk range as one block. The statement data and the argument data are written as
+      /// contiguous arrays.
+      static void internalWritePortable_Statements(
+          /* data from call */
+          FileIo& io, PortableHandleTable const& table,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from constantValueData */
+          size_t& curConstantPos, size_t const& endConstantPos, PassiveReal const* const constantValues,
+          /* data from passiveValueData */
+          size_t& curPassivePos, size_t const& endPassivePos, Real const* const passiveValues,
+          /* data from rhsIdentifiersData */
+          size_t& curRhsIdentifiersPos, size_t const& endRhsIdentifiersPos, Identifier const* const rhsIdentifiers,
+          /* data from statementData */
+          size_t& curStatementPos, size_t const& endStatementPos,
+          Config::ArgumentSize const* const numberOfPassiveArguments, EvalHandle const* const stmtEvalhandle,
+          /* data from index handler */
+          size_t const& startAdjointPos, size_t const& endAdjointPos) {
+        CODI_UNUSED(curLLFByteDataPos, endLLFByteDataPos, dataPtr, curLLFInfoDataPos, endLLFInfoDataPos, tokenPtr,
+                    dataSizePtr, endConstantPos, endPassivePos, endRhsIdentifiersPos, startAdjointPos,
+                    endAdjointPos);
+
+        if (curStatementPos == endStatementPos) {
+          return;
+        }
+
+        PortableBlockHeader header = {endStatementPos - curStatementPos, 0, 0, 0};
+        std::vector<uint32_t> handleIndices(header.statements);
+
+        EvalHandle lastHandle = stmtEvalhandle[curStatementPos];
+        uint32_t lastIndex = table.indices.find(lastHandle)->second;
+        for (size_t i = 0; i < header.statements; ++i) {
+          EvalHandle const handle = stmtEvalhandle[curStatementPos + i];
+          if (handle != lastHandle) {
+            lastHandle = handle;
+            lastIndex = table.indices.find(handle)->second;
+          }
+          handleIndices[i] = lastIndex;
+
+          Config::ArgumentSize const nPassiveValues = numberOfPassiveArguments[curStatementPos + i];
+          if (Config::StatementInputTag != nPassiveValues) {
+            header.activeArguments += table.entries[lastIndex]->activeArguments;
+            header.passiveArguments += nPassiveValues;
+            header.constantArguments += table.entries[lastIndex]->constantArguments;
+          }
+        }
+
+        io.writeData(&header, 1);
+        io.writeData(&numberOfPassiveArguments[curStatementPos], header.statements);
+        io.writeData(handleIndices.data(), header.statements);
+        io.writeData(&rhsIdentifiers[curRhsIdentifiersPos], header.activeArguments);
+        io.writeData(&passiveValues[curPassivePos], header.passiveArguments);
+        io.writeData(&constantValues[curConstantPos], header.constantArguments);
+
+        curStatementPos = endStatementPos;
+        curRhsIdentifiersPos += header.activeArguments;
+        curPassivePos += header.passiveArguments;
+        curConstantPos += header.constantArguments;
+      }
+
+      CODI_WRAP_FUNCTION(Wrap_internalWritePortable_Statements, internalWritePortable_Statements);
+#endif
+
+    public:
+
+      /*******************************************************************************/
+      /// @name Released primal values
+      /// @{
+
+      /**
+       * @brief Free the primal value vector and keep only the values that are required by a windowed reverse
+       * evaluation.
+       *
+       * See \ref releasedPrimals. The whole recording from the zero position to the current position is evaluated once
+       * in order to determine the required values. Tapes with low level functions result in an exception.
+       */
+      void releasePrimalValues() {
+        if (primalsReleased) {
+          return;
+        }
+
+        Identifier const largestIdentifier = Base::indexManager.get().getLargestCreatedIndex();
+        std::vector<bool> required(largestIdentifier + 1, false);
+
+        releasedWindows.clear();
+
+        Wrap_internalMarkRequiredPrimals_EvalStatements markFunc{};
+        Base::llfByteData.evaluateForward(this->getZeroPosition(), this->getPosition(), markFunc, *this, required,
+                                          Base::primals.data());
+
+        releasedPrimalIdentifiers.clear();
+        releasedPrimalValues.clear();
+        for (Identifier identifier = Config::MaxArgumentSize; identifier <= largestIdentifier; identifier += 1) {
+          if (required[identifier]) {
+            releasedPrimalIdentifiers.push_back(identifier);
+            releasedPrimalValues.push_back(Base::primals[identifier]);
+          }
+        }
+
+        std::vector<Real>().swap(Base::primals);
+        primalsReleased = true;
+      }
+
+      /// Recompute the full primal value vector from the values kept by releasePrimalValues().
+      void restorePrimalValues() {
+        if (!primalsReleased) {
+          return;
+        }
+
+        primalsReleased = false;
+        Base::checkPrimalSize(true);
+        for (size_t i = 0; i < releasedPrimalIdentifiers.size(); i += 1) {
+          Base::primals[releasedPrimalIdentifiers[i]] = releasedPrimalValues[i];
+        }
+
+        typename Base::Wrap_internalEvaluatePrimal_EvalStatements evalFunc{};
+        Base::llfByteData.evaluateForward(this->getZeroPosition(), this->getPosition(), evalFunc, *this,
+                                          Base::primals.data());
+
+        discardReleasedPrimals();
+      }
+
+      /// True if releasePrimalValues() was called and the primal values have not been restored.
+      bool arePrimalValuesReleased() const {
+        return primalsReleased;
+      }
+
+      /// Number of primal values that were kept by releasePrimalValues().
+      size_t getReleasedPrimalValuesSize() const {
+        return releasedPrimalValues.size();
+      }
+
+      /// @}
+
+    private:
+
+      bool primalsReleased;
+      std::vector<Identifier> releasedPrimalIdentifiers;  // Sorted.
+      std::vector<Real> releasedPrimalValues;
+
+      /// Data stream positions at the start of a window.
+      struct WindowStart {
+        public:
+          Identifier firstIdentifier;  ///< Identifier of the first statement.
+          size_t constantPos;          ///< Position in the constant value data.
+          size_t passivePos;           ///< Position in the passive value data.
+          size_t rhsIdentifiersPos;    ///< Position in the rhs identifier data.
+      };
+
+      std::vector<WindowStart> releasedWindows;  // Sorted.
+
+      /// Buffers for one window of the reverse evaluation with released primal values.
+      template<typename Adjoint>
+      struct PrimalWindow {
+        public:
+          Adjoint* adjoints;  ///< Adjoint vector of the evaluation.
+
+          std::vector<Real> primals;                       ///< Recomputed primal values of the window.
+          std::vector<Adjoint> windowAdjoints;             ///< Adjoints of the window.
+          std::vector<Identifier> rhsIdentifiers;          ///< Arguments mapped to window slots.
+          std::vector<Identifier> liveIns;                 ///< Arguments defined before the window.
+          std::unordered_map<Identifier, Identifier> slots;  ///< Window slots of the live ins.
+
+          /// Constructor
+          PrimalWindow(Adjoint* adjoints)
+              : adjoints(adjoints), primals(), windowAdjoints(), rhsIdentifiers(), liveIns(), slots() {}
+      };
+
+      void discardReleasedPrimals() {
+        std::vector<Identifier>().swap(releasedPrimalIdentifiers);
+        std::vector<Real>().swap(releasedPrimalValues);
+        std::vector<WindowStart>().swap(releasedWindows);
+        primalsReleased = false;
+      }
+
+      Real const& getReleasedPrimal(Identifier const& identifier) const {
+        auto pos = std::lower_bound(releasedPrimalIdentifiers.begin(), releasedPrimalIdentifiers.end(), identifier);
+        if (releasedPrimalIdentifiers.end() == pos || identifier != *pos) {
+          CODI_EXCEPTION(
+              "Primal value of identifier %d was not kept by releasePrimalValues(). Reverse evaluations with released "
+              "primal values have to end at the zero position of the tape.",
+              (int)identifier);
+        }
+
+        return releasedPrimalValues[pos - releasedPrimalIdentifiers.begin()];
+      }
+
+      WindowStart const& getReleasedWindow(Identifier const& firstIdentifier) const {
+        auto isBefore = [](WindowStart const& window, Identifier const& identifier) {
+          return window.firstIdentifier < identifier;
+        };
+
+        auto pos = std::lower_bound(releasedWindows.begin(), releasedWindows.end(), firstIdentifier, isBefore);
+        if (releasedWindows.end() == pos || firstIdentifier != pos->firstIdentifier) {
+          CODI_EXCEPTION(
+              "Reverse evaluations with released primal values have to end at the zero position of the tape.");
+        }
+
+        return *pos;
+      }
+
+      template<typename Adjoint>
+      void evaluateReleased(Position const& start, Position const& end, Adjoint* data) {
+        PrimalWindow<Adjoint> window(data);
+
+        typename Base::template VectorAccess<Adjoint> vectorAccess(data, nullptr);
+
+        EventSystem<PrimalValueLinearTape>::notifyTapeEvaluateListeners(
+            *this, start, end, &vectorAccess, EventHints::EvaluationKind::Reverse, EventHints::Endpoint::Begin);
+
+        Wrap_internalEvaluateReverseReleased_EvalStatements<Adjoint> evalFunc{};
+        Base::llfByteData.evaluateReverse(start, end, evalFunc, *this, window);
+
+        EventSystem<PrimalValueLinearTape>::notifyTapeEvaluateListeners(
+            *this, start, end, &vectorAccess, EventHints::EvaluationKind::Reverse, EventHints::Endpoint::End);
+      }
+
+      /// Evaluates the window and marks inputs and arguments that are defined before the window.
+      static void internalMarkRequiredPrimals_EvalStatements(
+          /* data from call */
+          PrimalValueLinearTape& tape, std::vector<bool>& required, Real* primalVector,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from constantValueData */
+          size_t& curConstantPos, size_t const& endConstantPos, PassiveReal const* const constantValues,
+          /* data from passiveValueData */
+          size_t& curPassivePos, size_t const& endPassivePos, Real const* const passiveValues,
+          /* data from rhsIdentifiersData */
+          size_t& curRhsIdentifiersPos, size_t const& endRhsIdentifiersPos, Identifier const* const rhsIdentifiers,
+          /* data from statementData */
+          size_t& curStatementPos, size_t const& endStatementPos,
+          Config::ArgumentSize const* const numberOfPassiveArguments, EvalHandle const* const stmtEvalhandle,
+          /* data from index handler */
+          size_t const& startAdjointPos, size_t const& endAdjointPos) {
+        CODI_UNUSED(curLLFByteDataPos, endLLFByteDataPos, dataPtr, curLLFInfoDataPos, endLLFInfoDataPos, tokenPtr,
+                    dataSizePtr, endConstantPos, endPassivePos, endRhsIdentifiersPos, endStatementPos);
+
+        if (startAdjointPos == endAdjointPos) {
+          return;  // Empty segment at a chunk boundary.
+        }
+
+        Identifier const firstIdentifier = (Identifier)startAdjointPos + 1;
+        tape.releasedWindows.push_back(
+            WindowStart{firstIdentifier, curConstantPos, curPassivePos, curRhsIdentifiersPos});
+
+        size_t curAdjointPos = startAdjointPos;
+        while (curAdjointPos < endAdjointPos) {
+          curAdjointPos += 1;
+
+          Config::ArgumentSize nPassiveValues = numberOfPassiveArguments[curStatementPos];
+
+          if (Config::StatementLowLevelFunctionTag == nPassiveValues) {
+            CODI_EXCEPTION("Primal values of tapes with low level functions can not be released.");
+          } else if (Config::StatementInputTag == nPassiveValues) {
+            required[curAdjointPos] = true;
+          } else {
+            size_t const stmtRhsIdentifiersPos = curRhsIdentifiersPos;
+
+            primalVector[curAdjointPos] = StatementEvaluator::template callPrimal<PrimalValueLinearTape>(
+                stmtEvalhandle[curStatementPos], primalVector, nPassiveValues, curConstantPos, constantValues,
+                curPassivePos, passiveValues, curRhsIdentifiersPos, rhsIdentifiers);
+
+            for (size_t pos = stmtRhsIdentifiersPos; pos < curRhsIdentifiersPos; pos += 1) {
+              Identifier const identifier = rhsIdentifiers[pos];
+              if ((Identifier)Config::MaxArgumentSize <= identifier && identifier < firstIdentifier) {
+                required[identifier] = true;
+              }
+            }
+          }
+
+          curStatementPos += 1;
+        }
+      }
+
+      CODI_WRAP_FUNCTION(Wrap_internalMarkRequiredPrimals_EvalStatements, internalMarkRequiredPrimals_EvalStatements);
+
+      /// Recomputes the primal values of the window and reverses it with window local adjoints. The window slots are
+      /// [passive arguments, statements of the window, live ins].
+      template<typename Adjoint>
+      static void internalEvaluateReverseReleased_EvalStatements(
+          /* data from call */
+          PrimalValueLinearTape& tape, PrimalWindow<Adjoint>& window,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from constantValueData */
+          size_t& curConstantPos, size_t const& endConstantPos, PassiveReal const* const constantValues,
+          /* data from passiveValueData */
+          size_t& curPassivePos, size_t const& endPassivePos, Real const* const passiveValues,
+          /* data from rhsIdentifiersData */
+          size_t& curRhsIdentifiersPos, size_t const& endRhsIdentifiersPos, Identifier const* const rhsIdentifiers,
+          /* data from statementData */
+          size_t& curStatementPos, size_t const& endStatementPos,
+          Config::ArgumentSize const* const numberOfPassiveArguments, EvalHandle const* const stmtEvalhandle,
+          /* data from index handler */
+          size_t const& startAdjointPos, size_t const& endAdjointPos) {
+        CODI_UNUSED(curLLFByteDataPos, endLLFByteDataPos, dataPtr, curLLFInfoDataPos, endLLFInfoDataPos, tokenPtr,
+                    dataSizePtr, endConstantPos, endPassivePos, endRhsIdentifiersPos, endStatementPos);
+
+        if (startAdjointPos == endAdjointPos) {
+          return;  // Empty segment at a chunk boundary.
+        }
+
+        Identifier const firstIdentifier = (Identifier)endAdjointPos + 1;
+        WindowStart const& windowStart = tape.getReleasedWindow(firstIdentifier);
+        size_t const statements = startAdjointPos - endAdjointPos;
+        size_t const statementOffset = Config::MaxArgumentSize;
+        size_t const liveInOffset = statementOffset + statements;
+
+        // Map the arguments to window slots.
+        window.liveIns.clear();
+        window.slots.clear();
+        window.rhsIdentifiers.resize(curRhsIdentifiersPos);
+        for (size_t pos = windowStart.rhsIdentifiersPos; pos < curRhsIdentifiersPos; pos += 1) {
+          Identifier const identifier = rhsIdentifiers[pos];
+
+          if (identifier < (Identifier)Config::MaxArgumentSize) {
+            window.rhsIdentifiers[pos] = identifier;  // Passive argument.
+          } else if (identifier >= firstIdentifier) {
+            window.rhsIdentifiers[pos] = statementOffset + (identifier - firstIdentifier);
+          } else {
+            auto slot = window.slots.find(identifier);
+            if (window.slots.end() == slot) {
+              slot = window.slots.insert(std::make_pair(identifier, liveInOffset + window.liveIns.size())).first;
+              window.liveIns.push_back(identifier);
+            }
+            window.rhsIdentifiers[pos] = slot->second;
+          }
+        }
+
+        size_t const windowSize = liveInOffset + window.liveIns.size();
+        window.primals.assign(windowSize, Real());
+        window.windowAdjoints.assign(windowSize, Adjoint());
+
+        for (size_t i = 0; i < window.liveIns.size(); i += 1) {
+          window.primals[liveInOffset + i] = tape.getReleasedPrimal(window.liveIns[i]);
+        }
+        for (size_t i = 0; i < statements; i += 1) {
+          window.windowAdjoints[statementOffset + i] = window.adjoints[firstIdentifier + i];
+        }
+
+        Real* primalVector = window.primals.data();
+        Identifier const* const windowRhsIdentifiers = window.rhsIdentifiers.data();
+
+        // Recompute the primal values of the window.
+        size_t constantPos = windowStart.constantPos;
+        size_t passivePos = windowStart.passivePos;
+        size_t rhsIdentifiersPos = windowStart.rhsIdentifiersPos;
+        for (size_t i = 0; i < statements; i += 1) {
+          size_t const statementPos = curStatementPos - statements + i;
+          Config::ArgumentSize nPassiveValues = numberOfPassiveArguments[statementPos];
+
+          if (Config::StatementInputTag == nPassiveValues) CODI_Unlikely {
+            primalVector[statementOffset + i] = tape.getReleasedPrimal(firstIdentifier + i);
+          } else CODI_Likely {
+            primalVector[statementOffset + i] = StatementEvaluator::template callPrimal<PrimalValueLinearTape>(
+                stmtEvalhandle[statementPos], primalVector, nPassiveValues, constantPos, constantValues, passivePos,
+                passiveValues, rhsIdentifiersPos, windowRhsIdentifiers);
+          }
+        }
+
+        // Reverse the window.
+        typename Base::template VectorAccess<Adjoint> vectorAccess(window.windowAdjoints.data(), primalVector);
+        ADJOINT_VECTOR_TYPE* adjointVector = tape.selectAdjointVector(&vectorAccess, window.windowAdjoints.data());
+
+        size_t curAdjointPos = startAdjointPos;
+        while (curAdjointPos > endAdjointPos) CODI_Likely {
+          curStatementPos -= 1;
+
+          size_t const slot = statementOffset + (curAdjointPos - firstIdentifier);
+          Config::ArgumentSize nPassiveValues = numberOfPassiveArguments[curStatementPos];
+
+          if (Config::StatementInputTag == nPassiveValues) CODI_Unlikely {
+            // Do nothing.
+          } else CODI_Likely {
+#if CODI_VariableAdjointInterfaceInPrimalTapes
+
+            EventSystem<PrimalValueLinearTape>::notifyStatementEvaluateListeners(
+                tape, curAdjointPos, adjointVector->getVectorSize(), adjointVector->getAdjointVec(slot));
+
+            Gradient const lhsAdjoint{};
+            adjointVector->setLhsAdjoint(slot);
+#else
+            Gradient const lhsAdjoint = adjointVector[slot];
+
+            if (Config::StatementEvents) {
+              EventSystem<PrimalValueLinearTape>::notifyStatementEvaluateListeners(
+                  tape, curAdjointPos, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsAdjoint).data());
+            }
+
+            if (Config::ReversalZeroesAdjoints) {
+              adjointVector[slot] = Gradient();
+            }
+#endif
+            EventSystem<PrimalValueLinearTape>::notifyStatementEvaluatePrimalListeners(tape, curAdjointPos,
+                                                                                       primalVector[slot]);
+
+            StatementEvaluator::template callReverse<PrimalValueLinearTape>(
+                stmtEvalhandle[curStatementPos], primalVector, adjointVector, lhsAdjoint, nPassiveValues,
+                curConstantPos, constantValues, curPassivePos, passiveValues, curRhsIdentifiersPos,
+                windowRhsIdentifiers);
+          }
+
+          curAdjointPos -= 1;
+        }
+
+        // Write the window adjoints back.
+        for (size_t i = 0; i < statements; i += 1) {
+          window.adjoints[firstIdentifier + i] = window.windowAdjoints[statementOffset + i];
+        }
+        for (size_t i = 0; i < window.liveIns.size(); i += 1) {
+          window.adjoints[window.liveIns[i]] += window.windowAdjoints[liveInOffset + i];
+        }
+      }
+
+      CODI_WRAP_FUNCTION_TEMPLATE(Wrap_internalEvaluateReverseReleased_EvalStatements,
+                                  internalEvaluateReverseReleased_EvalStatements);
   };
 }
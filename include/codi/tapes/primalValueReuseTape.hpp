@@ -165,8 +165,10 @@ namespace codi {
                 tape, lhsIdentifier, adjointVector->getVectorSize(), adjointVector->getAdjointVec(lhsIdentifier));
 #else
             adjointVector[lhsIdentifier] = lhsTangent;
-            EventSystem<PrimalValueReuseTape>::notifyStatementEvaluateListeners(
-                tape, lhsIdentifier, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsTangent).data());
+            if (Config::StatementEvents) {
+              EventSystem<PrimalValueReuseTape>::notifyStatementEvaluateListeners(
+                  tape, lhsIdentifier, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsTangent).data());
+            }
 #endif
             EventSystem<PrimalValueReuseTape>::notifyStatementEvaluatePrimalListeners(tape, lhsIdentifier,
                                                                                       primalVector[lhsIdentifier]);
@@ -221,6 +223,63 @@ namespace codi {
         }
       }
 
+      /// \copydoc codi::PrimalValueBaseTape::internalEvaluatePrimalBuildSchedule_EvalStatements
+      CODI_INLINE static void internalEvaluatePrimalBuildSchedule_EvalStatements(
+          /* data from call */
+          PrimalValueReuseTape& tape, Real* primalVector, typename Base::PrimalSchedule& schedule,
+          /* data from low level function byte data vector */
+          size_t& curLLFByteDataPos, size_t const& endLLFByteDataPos, char* dataPtr,
+          /* data from low level function info data vector */
+          size_t& curLLFInfoDataPos, size_t const& endLLFInfoDataPos, Config::LowLevelFunctionToken* const tokenPtr,
+          Config::LowLevelFunctionDataSize* const dataSizePtr,
+          /* data from constantValueData */
+          size_t& curConstantPos, size_t const& endConstantPos, PassiveReal const* const constantValues,
+          /* data from passiveValueData */
+          size_t& curPassivePos, size_t const& endPassivePos, Real const* const passiveValues,
+          /* data from rhsIdentifiersData */
+          size_t& curRhsIdentifiersPos, size_t const& endRhsIdentifiersPos, Identifier const* const rhsIdentifiers,
+          /* data from statementData */
+          size_t& curStatementPos, size_t const& endStatementPos, Identifier const* const lhsIdentifiers,
+          Config::ArgumentSize const* const numberOfPassiveArguments, Real* const oldPrimalValues,
+          EvalHandle const* const stmtEvalhandle) {
+        CODI_UNUSED(endLLFByteDataPos, endLLFInfoDataPos, endConstantPos, endPassivePos, endRhsIdentifiersPos);
+
+        typename Base::template VectorAccess<Gradient> vectorAccess(nullptr, primalVector);
+
+        while (curStatementPos < endStatementPos) CODI_Likely {
+          Config::ArgumentSize nPassiveValues = numberOfPassiveArguments[curStatementPos];
+
+          if (Config::StatementLowLevelFunctionTag == nPassiveValues) CODI_Unlikely {
+            schedule.pushLowLevelFunction(dataPtr, curLLFByteDataPos, tokenPtr, dataSizePtr, curLLFInfoDataPos);
+
+            Base::template callLowLevelFunction<LowLevelFunctionEntryCallKind::Primal>(
+                tape, true, curLLFByteDataPos, dataPtr, curLLFInfoDataPos, tokenPtr, dataSizePtr, &vectorAccess);
+          } else CODI_Likely {
+            Identifier const lhsIdentifier = lhsIdentifiers[curStatementPos];
+
+            size_t const stmtConstantPos = curConstantPos;
+            size_t const stmtPassivePos = curPassivePos;
+            size_t const stmtRhsIdentifiersPos = curRhsIdentifiersPos;
+
+            oldPrimalValues[curStatementPos] = primalVector[lhsIdentifier];
+            primalVector[lhsIdentifier] = StatementEvaluator::template callPrimal<PrimalValueReuseTape>(
+                stmtEvalhandle[curStatementPos], primalVector, nPassiveValues, curConstantPos, constantValues,
+                curPassivePos, passiveValues, curRhsIdentifiersPos, rhsIdentifiers);
+
+            schedule.pushStatement(lhsIdentifier, nPassiveValues, stmtEvalhandle[curStatementPos],
+                                   &constantValues[stmtConstantPos], &passiveValues[stmtPassivePos],
+                                   &rhsIdentifiers[stmtRhsIdentifiersPos],
+                                   curRhsIdentifiersPos - stmtRhsIdentifiersPos,
+                                   &oldPrimalValues[curStatementPos]);
+
+            EventSystem<PrimalValueReuseTape>::notifyStatementEvaluatePrimalListeners(tape, lhsIdentifier,
+                                                                                      primalVector[lhsIdentifier]);
+          }
+
+          curStatementPos += 1;
+        }
+      }
+
       /// \copydoc codi::PrimalValueBaseTape::internalEvaluateReverse_EvalStatements
       CODI_INLINE static void internalEvaluateReverse_EvalStatements(
           /* data from call */
@@ -270,8 +329,10 @@ namespace codi {
             adjointVector->setLhsAdjoint(lhsIdentifier);
 #else
             Gradient const lhsAdjoint = adjointVector[lhsIdentifier];
-            EventSystem<PrimalValueReuseTape>::notifyStatementEvaluateListeners(
-                tape, lhsIdentifier, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsAdjoint).data());
+            if (Config::StatementEvents) {
+              EventSystem<PrimalValueReuseTape>::notifyStatementEvaluateListeners(
+                  tape, lhsIdentifier, GradientTraits::dim<Gradient>(), GradientTraits::toArray(lhsAdjoint).data());
+            }
             adjointVector[lhsIdentifier] = Gradient();
 #endif
             EventSystem<PrimalValueReuseTape>::notifyStatementEvaluatePrimalListeners(tape, lhsIdentifier,
@@ -287,6 +348,10 @@ namespace codi {
         }
       }
 
+      /// \copydoc codi::PrimalValueBaseTape::internalCheckPrimalValuesAvailable
+      /// Empty implementation; the primal value vector is always available.
+      CODI_INLINE void internalCheckPrimalValuesAvailable() const {}
+
       /// \copydoc codi::PrimalValueBaseTape::internalResetPrimalValues
       CODI_INLINE void internalResetPrimalValues(Position const& pos) {
         // Reset primals.
@@ -0,0 +1,443 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Activity and sparsity analysis on top of the tag propagation of the tagging tapes.
+   *
+   * Each registered input gets its own bit. Every tagged value carries the index of a dependency set in
+   * TagDependencies::dependencies, which is the union of the sets of all active arguments of the last statement that assigned
+   * the value. Dependency sets are stored only once and are looked up by their hash. The union of two sets is computed
+   * only once, later unions of the same sets are answered from a cache. Since most statements depend on the same inputs
+   * as one of their arguments, the analysis stays cheap enough for production size runs.
+   *
+   * In addition, the statements are counted for each tag (region). A statement is active if at least one argument is
+   * active. Passive statements and assignments of passive values to active types do not require taping. A high number
+   * of them in a region indicates that active types are used where passive types would suffice.
+   *
+   * The analysis is disabled by default. It requires Config::TagAnalysis, such that the tag data carries the dependency
+   * sets. See TagTapeBase::setAnalysisEnabled().
+   *
+   * @tparam T_Tag  The type of the tag, usually int.
+   */
+  template<typename T_Tag>
+  struct TagAnalysis {
+    public:
+
+      using Tag = CODI_DD(T_Tag, int);  ///< See TagAnalysis.
+
+      using DependencySet = int;  ///< Index of a dependency set. 0 is the empty set.
+
+      /// Statement counts for one tag.
+      struct RegionCounts {
+        public:
+          size_t activeStatements;   ///< Statements with at least one active argument.
+          size_t passiveStatements;  ///< Statements without active arguments.
+          size_t passiveAssigns;     ///< Assignments of passive values to active types.
+
+          /// Constructor.
+          RegionCounts() : activeStatements(0), passiveStatements(0), passiveAssigns(0) {}
+
+          /// Number of statements that do not need to be taped.
+          size_t getWasted() const {
+            return passiveStatements + passiveAssigns;
+          }
+
+          /// Number of all statements.
+          size_t getTotal() const {
+            return activeStatements + getWasted();
+          }
+      };
+
+    private:
+
+      using Word = uint64_t;
+      static size_t constexpr WordBits = 64;
+
+      bool enabled;
+
+      std::vector<std::vector<Word>> sets;
+      std::unordered_multimap<size_t, DependencySet> setLookup;  ///< Hash of the words to the sets with this hash.
+      std::unordered_map<uint64_t, DependencySet> combineCache;  ///< Pair of sets to their union.
+      std::vector<Word> combineWords;                            ///< Scratch space for combine.
+
+      size_t numberOfInputs;
+      DependencySet allInputsSet;  // Cache for getAllInputsSet, 0 if not computed.
+      std::vector<DependencySet> outputs;
+
+      std::map<Tag, RegionCounts> regions;
+      Tag currentRegionTag;
+      RegionCounts* currentRegion;  ///< Counts of currentRegionTag, nullptr if not looked up yet.
+
+    public:
+
+      /// Constructor.
+      TagAnalysis()
+          : enabled(false),
+            sets(1),
+            setLookup(),
+            combineCache(),
+            combineWords(),
+            numberOfInputs(0),
+            allInputsSet(0),
+            outputs(),
+            regions(),
+            currentRegionTag(),
+            currentRegion(nullptr) {}
+
+      /// Enable or disable the analysis.
+      void setEnabled(bool enabled) {
+        this->enabled = enabled;
+      }
+
+      /// If the analysis is enabled.
+      CODI_INLINE bool isEnabled() const {
+        return enabled;
+      }
+
+      /// Remove all inputs, outputs, dependency sets and statement counts. Frees the memory of the analysis.
+      void reset() {
+        std::vector<std::vector<Word>>(1).swap(sets);
+        std::unordered_multimap<size_t, DependencySet>().swap(setLookup);
+        std::unordered_map<uint64_t, DependencySet>().swap(combineCache);
+        std::vector<Word>().swap(combineWords);
+        numberOfInputs = 0;
+        allInputsSet = 0;
+        std::vector<DependencySet>().swap(outputs);
+        regions.clear();
+        currentRegion = nullptr;
+      }
+
+      /*******************************************************************************/
+      /// @name Recording
+      /// @{
+
+      /// Add a new input. Returns the dependency set that contains only this input.
+      DependencySet addInput() {
+        size_t input = numberOfInputs;
+        numberOfInputs += 1;
+        allInputsSet = 0;
+
+        std::vector<Word> words(input / WordBits + 1, Word(0));
+        words[input / WordBits] = Word(1) << (input % WordBits);
+
+        return intern(words);
+      }
+
+      /// Add a new output with the given dependency set.
+      void addOutput(DependencySet const& set) {
+        outputs.push_back(set);
+      }
+
+      /// Dependency set of all inputs registered so far. Used for values with unknown dependencies.
+      DependencySet getAllInputsSet() {
+        if (0 == allInputsSet && 0 != numberOfInputs) {
+          std::vector<Word> words((numberOfInputs - 1) / WordBits + 1, ~Word(0));
+          if (0 != numberOfInputs % WordBits) {
+            words.back() = (Word(1) << (numberOfInputs % WordBits)) - 1;
+          }
+          allInputsSet = intern(words);
+        }
+
+        return allInputsSet;
+      }
+
+      /// Union of two dependency sets.
+      DependencySet combine(DependencySet const& a, DependencySet const& b) {
+        if (0 == a || a == b) {
+          return b;
+        } else if (0 == b) {
+          return a;
+        }
+
+        uint64_t const key = a < b ? ((uint64_t)a << 32) | (uint64_t)b : ((uint64_t)b << 32) | (uint64_t)a;
+        auto cached = combineCache.find(key);
+        if (cached != combineCache.end()) {
+          return cached->second;
+        }
+
+        std::vector<Word> const& setA = sets[a];
+        std::vector<Word> const& setB = sets[b];
+        combineWords.assign(std::max(setA.size(), setB.size()), Word(0));
+        for (size_t pos = 0; pos < setA.size(); pos += 1) {
+          combineWords[pos] |= setA[pos];
+        }
+        for (size_t pos = 0; pos < setB.size(); pos += 1) {
+          combineWords[pos] |= setB[pos];
+        }
+
+        DependencySet result;
+        if (combineWords == setA) {
+          result = a;
+        } else if (combineWords == setB) {
+          result = b;
+        } else {
+          result = intern(combineWords);
+        }
+        combineCache.insert(std::make_pair(key, result));
+
+        return result;
+      }
+
+      /// New empty set that is not shared with other values. It is filled with addToOpenSet and must not be combined
+      /// before it is complete. Used for manual statements, whose arguments are pushed one by one.
+      DependencySet openSet() {
+        DependencySet set = static_cast<DependencySet>(sets.size());
+        sets.push_back(std::vector<Word>());
+
+        return set;
+      }
+
+      /// Add the dependencies of an argument to a set created by openSet.
+      void addToOpenSet(DependencySet const& open, DependencySet const& argument) {
+        if (0 == argument) {
+          return;
+        }
+
+        std::vector<Word> const& words = sets[argument];
+        std::vector<Word>& openWords = sets[open];
+        if (openWords.size() < words.size()) {
+          openWords.resize(words.size(), Word(0));
+        }
+        for (size_t pos = 0; pos < words.size(); pos += 1) {
+          openWords[pos] |= words[pos];
+        }
+      }
+
+      /// Count a statement in the region of the tag.
+      CODI_INLINE void countStatement(Tag const& tag, bool active) {
+        RegionCounts& counts = getRegion(tag);
+        if (active) {
+          counts.activeStatements += 1;
+        } else {
+          counts.passiveStatements += 1;
+        }
+      }
+
+      /// Count the assignment of a passive value in the region of the tag.
+      CODI_INLINE void countPassiveAssign(Tag const& tag) {
+        getRegion(tag).passiveAssigns += 1;
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Results
+      /// @{
+
+      /// Number of registered inputs.
+      size_t getNumberOfInputs() const {
+        return numberOfInputs;
+      }
+
+      /// Number of registered outputs.
+      size_t getNumberOfOutputs() const {
+        return outputs.size();
+      }
+
+      /// Number of distinct dependency sets, without the empty set.
+      size_t getNumberOfDependencySets() const {
+        return sets.size() - 1;
+      }
+
+      /// Inputs on which the output depends, in ascending order.
+      std::vector<size_t> getOutputDependencies(size_t output) const {
+        std::vector<size_t> inputs;
+        std::vector<Word> const& words = sets[outputs[output]];
+        for (size_t pos = 0; pos < words.size(); pos += 1) {
+          for (size_t bit = 0; bit < WordBits; bit += 1) {
+            if (0 != (words[pos] & (Word(1) << bit))) {
+              inputs.push_back(pos * WordBits + bit);
+            }
+          }
+        }
+
+        return inputs;
+      }
+
+      /// Sparsity pattern of the Jacobian. Entry i contains the nonzero columns of row i.
+      std::vector<std::vector<size_t>> getSparsityPattern() const {
+        std::vector<std::vector<size_t>> pattern(outputs.size());
+        for (size_t output = 0; output < outputs.size(); output += 1) {
+          pattern[output] = getOutputDependencies(output);
+        }
+
+        return pattern;
+      }
+
+      /// Number of nonzero entries in the Jacobian.
+      size_t getNumberOfNonZeros() const {
+        size_t nonZeros = 0;
+        for (DependencySet const& set : outputs) {
+          for (Word const& word : sets[set]) {
+            nonZeros += countBits(word);
+          }
+        }
+
+        return nonZeros;
+      }
+
+      /// Statement counts for each tag.
+      std::map<Tag, RegionCounts> const& getRegionCounts() const {
+        return regions;
+      }
+
+      /**
+       * @brief Write a human readable report.
+       *
+       * Contains the statement counts of each region and the sparsity pattern of the Jacobian. The pattern is only
+       * written, if it has at most maxPatternRows rows.
+       */
+      template<typename Stream = std::ostream>
+      void printReport(Stream& out = std::cout, size_t maxPatternRows = 100) const {
+        std::ios_base::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision();
+
+        RegionCounts total;
+
+        out << "-------------------------------------" << std::endl;
+        out << "CoDi Tag Analysis" << std::endl;
+        out << "-------------------------------------" << std::endl;
+        out << "Statements per tag:" << std::endl;
+        out << std::setw(12) << "Tag" << std::setw(12) << "Total" << std::setw(12) << "Active" << std::setw(12)
+            << "Passive" << std::setw(12) << "Assign" << std::setw(12) << "Wasted %" << std::endl;
+        for (auto const& region : regions) {
+          printRegion(out, region.first, region.second);
+
+          total.activeStatements += region.second.activeStatements;
+          total.passiveStatements += region.second.passiveStatements;
+          total.passiveAssigns += region.second.passiveAssigns;
+        }
+        printRegion(out, "all", total);
+
+        size_t nonZeros = getNumberOfNonZeros();
+        double denseSize = static_cast<double>(numberOfInputs) * static_cast<double>(outputs.size());
+        out << "-------------------------------------" << std::endl;
+        out << "Jacobian: " << outputs.size() << " x " << numberOfInputs << ", " << nonZeros << " nonzeros";
+        if (0.0 != denseSize) {
+          out << " (" << std::fixed << std::setprecision(2) << 100.0 * static_cast<double>(nonZeros) / denseSize
+              << "% dense)";
+        }
+        out << std::endl;
+        out << "Distinct dependency sets: " << getNumberOfDependencySets() << std::endl;
+
+        if (outputs.size() <= maxPatternRows) {
+          for (size_t output = 0; output < outputs.size(); output += 1) {
+            out << "  output " << output << ":";
+            for (size_t const& input : getOutputDependencies(output)) {
+              out << " " << input;
+            }
+            out << std::endl;
+          }
+        }
+        out << "-------------------------------------" << std::endl;
+
+        out.flags(flags);
+        out.precision(precision);
+      }
+
+      /// @}
+
+    private:
+
+      CODI_INLINE RegionCounts& getRegion(Tag const& tag) {
+        if (nullptr == currentRegion || currentRegionTag != tag) CODI_Unlikely {
+          currentRegion = &regions[tag];
+          currentRegionTag = tag;
+        }
+
+        return *currentRegion;
+      }
+
+      static size_t hash(std::vector<Word> const& words) {
+        uint64_t value = 14695981039346656037ull;
+        for (Word const& word : words) {
+          value = (value ^ word) * 1099511628211ull;
+        }
+
+        return static_cast<size_t>(value);
+      }
+
+      DependencySet intern(std::vector<Word> const& words) {
+        size_t const key = hash(words);
+        auto range = setLookup.equal_range(key);
+        for (auto iter = range.first; iter != range.second; ++iter) {
+          if (sets[iter->second] == words) {
+            return iter->second;
+          }
+        }
+
+        DependencySet set = static_cast<DependencySet>(sets.size());
+        sets.push_back(words);
+        setLookup.insert(std::make_pair(key, set));
+
+        return set;
+      }
+
+      static size_t countBits(Word word) {
+        size_t count = 0;
+        while (0 != word) {
+          word &= word - 1;
+          count += 1;
+        }
+
+        return count;
+      }
+
+      template<typename Stream, typename Name>
+      static void printRegion(Stream& out, Name const& name, RegionCounts const& counts) {
+        double wasted = 0.0;
+        if (0 != counts.getTotal()) {
+          wasted = 100.0 * static_cast<double>(counts.getWasted()) / static_cast<double>(counts.getTotal());
+        }
+
+        out << std::setw(12) << name << std::setw(12) << counts.getTotal() << std::setw(12) << counts.activeStatements
+            << std::setw(12) << counts.passiveStatements << std::setw(12) << counts.passiveAssigns << std::setw(12)
+            << std::fixed << std::setprecision(2) << wasted << std::endl;
+      }
+  };
+}
@@ -51,9 +51,49 @@ namespace codi {
     MaxElement    ///< Maximum number of elements.
   };
 
+  /// Dependency set of a tagged value, see TagAnalysis. Empty unless Config::TagAnalysis is enabled.
+  template<bool T_enabled>
+  struct TagDependencies {
+    public:
+
+      /// Constructor.
+      constexpr TagDependencies() {}
+
+      /// Always the empty set.
+      CODI_INLINE int getDependencies() const {
+        return 0;
+      }
+
+      /// Does nothing.
+      CODI_INLINE void setDependencies(int const& dependencies) {
+        CODI_UNUSED(dependencies);
+      }
+  };
+
+  /// Dependency set of a tagged value, see TagAnalysis.
+  template<>
+  struct TagDependencies<true> {
+    public:
+
+      int dependencies;  ///< Index of the dependency set.
+
+      /// Constructor.
+      constexpr TagDependencies() : dependencies(0) {}
+
+      /// Index of the dependency set.
+      CODI_INLINE int getDependencies() const {
+        return dependencies;
+      }
+
+      /// Set the index of the dependency set.
+      CODI_INLINE void setDependencies(int const& dependencies) {
+        this->dependencies = dependencies;
+      }
+  };
+
   /// Data for a tag.
   template<typename T_Tag>
-  struct TagData {
+  struct TagData : public TagDependencies<Config::TagAnalysis> {
     public:
 
       using Tag = CODI_DD(T_Tag, int);  ///< See TagData.
@@ -62,10 +102,10 @@ namespace codi {
       EnumBitset<TagFlags> properties;  ///< Current properties of the value.
 
       /// Constructor.
-      constexpr TagData() : tag(), properties() {}
+      constexpr TagData() : TagDependencies<Config::TagAnalysis>(), tag(), properties() {}
 
       /// Constructor.
-      TagData(Tag tag) : tag(tag), properties() {}
+      TagData(Tag tag) : TagDependencies<Config::TagAnalysis>(), tag(tag), properties() {}
 
       /// Operator for satisfying other software.
       TagData& operator+=(TagData const& o) {
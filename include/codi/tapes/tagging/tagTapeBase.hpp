@@ -39,6 +39,7 @@
 #include "../indices/indexManagerInterface.hpp"
 #include "../interfaces/fullTapeInterface.hpp"
 #include "../misc/adjointVectorAccess.hpp"
+#include "tagAnalysis.hpp"
 #include "tagData.hpp"
 
 /** \copydoc codi::Namespace */
@@ -64,6 +65,9 @@ namespace codi {
    *
    * Provides all basic management routines for the tag.
    *
+   * With setAnalysisEnabled(), the tag propagation additionally computes the input-output dependencies and statement
+   * counts for each tag. See TagAnalysis for details.
+   *
    * See tests/functional/src/testTagging.cpp for an example.
    *
    * @tparam T_Real  The computation type of a tape, usually chosen as ActiveType::Real.
@@ -101,6 +105,10 @@ namespace codi {
       bool preaccumulationHandling;  ///< Parameter to enable/disable preaccumulation handling.
       Tag preaccumulationTag;        ///< Tag used for preaccumulation specialized handling.
 
+      TagAnalysis<Tag> analysis;                              ///< Activity and sparsity analysis.
+      typename TagAnalysis<Tag>::DependencySet manualSet;   ///< Open set of the current manual statement, 0 if none.
+      size_t manualArgumentsRemaining;                        ///< Arguments of the current manual statement to push.
+
     public:
 
       /// Constructor.
@@ -111,7 +119,10 @@ namespace codi {
             tagErrorCallback(defaultTagErrorCallback),
             tagErrorUserData(this),
             preaccumulationHandling(true),
-            preaccumulationTag(1337) {}
+            preaccumulationTag(1337),
+            analysis(),
+            manualSet(0),
+            manualArgumentsRemaining(0) {}
 
       /// Looks at the tags for the expression.
       struct ValidateTags : public ForEachLeafLogic<ValidateTags> {
@@ -126,6 +137,21 @@ namespace codi {
           }
       };
 
+      /// Computes the union of the dependency sets of the expression arguments.
+      struct CollectDependencies : public ForEachLeafLogic<CollectDependencies> {
+        public:
+
+          /// \copydoc codi::ForEachLeafLogic::handleActive
+          template<typename Node>
+          CODI_INLINE void handleActive(Node const& node, typename TagAnalysis<Tag>::DependencySet& set,
+                                        TagAnalysis<Tag>& analysis) {
+            Identifier const& tagData = node.getIdentifier();
+            if (PassiveTag != tagData.tag && InvalidTag != tagData.tag) {
+              set = analysis.combine(set, tagData.getDependencies());
+            }
+          }
+      };
+
       /// Swap members.
       void swap(Impl& other) {
         std::swap(curTag, other.curTag);
@@ -135,6 +161,9 @@ namespace codi {
         std::swap(tagErrorUserData, other.tagErrorUserData);
         std::swap(preaccumulationHandling, other.preaccumulationHandling);
         std::swap(preaccumulationTag, other.preaccumulationTag);
+        std::swap(analysis, other.analysis);
+        std::swap(manualSet, other.manualSet);
+        std::swap(manualArgumentsRemaining, other.manualArgumentsRemaining);
       }
 
       /*******************************************************************************/
@@ -220,6 +249,63 @@ namespace codi {
         return preaccumulationTag;
       }
 
+      /// @}
+      /*******************************************************************************/
+      /// @name Activity and sparsity analysis
+      /// @{
+
+      /// Enable or disable the analysis. Default: false. Requires Config::TagAnalysis. See TagAnalysis.
+      void setAnalysisEnabled(bool enabled) {
+        if (enabled && !Config::TagAnalysis) {
+          CODI_EXCEPTION("The tag analysis requires the compile time option CODI_TagAnalysis.");
+        }
+        analysis.setEnabled(enabled);
+      }
+
+      /// If the analysis is enabled.
+      bool isAnalysisEnabled() const {
+        return analysis.isEnabled();
+      }
+
+      /// Results of the analysis.
+      TagAnalysis<Tag> const& getAnalysis() const {
+        return analysis;
+      }
+
+      /// Remove all results of the analysis. Dependency sets of existing values become invalid.
+      void resetAnalysis() {
+        analysis.reset();
+        manualSet = 0;
+        manualArgumentsRemaining = 0;
+      }
+
+      /// Write the report of the analysis. See TagAnalysis::printReport.
+      template<typename Stream = std::ostream>
+      void printAnalysisReport(Stream& out = std::cout, size_t maxPatternRows = 100) const {
+        analysis.printReport(out, maxPatternRows);
+      }
+
+      /// Declare the value as an input of the analysis. Called by registerInput of reverse tapes.
+      template<typename Lhs>
+      void registerAnalysisInput(LhsExpressionInterface<Real, Gradient, Impl, Lhs>& value) {
+        if (analysis.isEnabled()) {
+          value.cast().getIdentifier().setDependencies(analysis.addInput());
+        }
+      }
+
+      /// Declare the value as an output of the analysis. Called by registerOutput of reverse tapes.
+      template<typename Lhs>
+      void registerAnalysisOutput(LhsExpressionInterface<Real, Gradient, Impl, Lhs>& value) {
+        if (analysis.isEnabled()) {
+          Identifier const& identifier = value.cast().getIdentifier();
+          if (PassiveTag != identifier.tag && InvalidTag != identifier.tag) {
+            analysis.addOutput(identifier.getDependencies());
+          } else {
+            analysis.addOutput(0);
+          }
+        }
+      }
+
     protected:
 
       /// Checks if the tag is correct. Errors are set on the ValidationIndicator object.
@@ -337,6 +423,68 @@ namespace codi {
         tag = Tag();
       }
 
+      /// Count the statement and set the dependencies of the lhs.
+      template<typename Rhs>
+      CODI_INLINE void analyzeStatement(Identifier& lhsIdentifier, ExpressionInterface<Real, Rhs> const& rhs,
+                                        bool isActive) {
+        if (analysis.isEnabled()) CODI_Unlikely {
+          analysis.countStatement(curTag, isActive);
+
+          typename TagAnalysis<Tag>::DependencySet set = 0;
+          if (isActive) {
+            CollectDependencies collect;
+            collect.eval(rhs, set, analysis);
+          }
+          lhsIdentifier.setDependencies(set);
+        }
+      }
+
+      /// Count the passive assignment and clear the dependencies of the lhs.
+      CODI_INLINE void analyzePassiveAssign(Identifier& lhsIdentifier) {
+        if (analysis.isEnabled()) CODI_Unlikely {
+          analysis.countPassiveAssign(curTag);
+          lhsIdentifier.setDependencies(0);
+        }
+      }
+
+      /// Count the manual statement and give the lhs a new dependency set. The next size arguments are added to the
+      /// set by analyzeManualArgument. Only the set is remembered, not the lhs.
+      CODI_INLINE void analyzeManualStatement(Identifier& lhsIdentifier, Config::ArgumentSize const& size) {
+        if (analysis.isEnabled()) CODI_Unlikely {
+          analysis.countStatement(curTag, true);
+
+          if (0 != size) {
+            manualSet = analysis.openSet();
+            manualArgumentsRemaining = size;
+          } else {
+            manualSet = 0;
+            manualArgumentsRemaining = 0;
+          }
+          lhsIdentifier.setDependencies(manualSet);
+        }
+      }
+
+      /// Add the argument of a manual statement push to the dependency set of its lhs.
+      CODI_INLINE void analyzeManualArgument(Identifier const& identifier) {
+        if (analysis.isEnabled() && 0 != manualSet) CODI_Unlikely {
+          if (PassiveTag != identifier.tag && InvalidTag != identifier.tag) {
+            analysis.addToOpenSet(manualSet, identifier.getDependencies());
+          }
+
+          manualArgumentsRemaining -= 1;
+          if (0 == manualArgumentsRemaining) {
+            manualSet = 0;
+          }
+        }
+      }
+
+      /// Values with unknown dependencies, e.g. outputs of external functions, depend on all inputs.
+      CODI_INLINE void analyzeUnknownDependencies(Identifier& lhsIdentifier) {
+        if (analysis.isEnabled()) CODI_Unlikely {
+          lhsIdentifier.setDependencies(analysis.getAllInputsSet());
+        }
+      }
+
       /// @}
   };
 }
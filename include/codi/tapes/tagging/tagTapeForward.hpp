@@ -124,6 +124,8 @@ namespace codi {
 
         Base::handleError(vi);
 
+        Base::analyzeStatement(lhs.cast().getIdentifier(), rhs, vi.isActive);
+
         if (vi.isActive) {
           Base::setTag(lhs.cast().getIdentifier().tag);
         } else {
@@ -145,6 +147,8 @@ namespace codi {
       void store(LhsExpressionInterface<Real, Gradient, TagTapeForward, Lhs>& lhs, Real const& rhs) {
         Base::checkLhsError(lhs, rhs);
 
+        Base::analyzePassiveAssign(lhs.cast().getIdentifier());
+
         Base::resetTag(lhs.cast().getIdentifier().tag);
 
         lhs.cast().value() = rhs;
@@ -109,18 +109,28 @@ namespace codi {
       /// @{
 
       /// Do nothing.
-      void writeToFile(std::string const& filename) const {
-        CODI_UNUSED(filename);
+      void writeToFile(std::string const& filename, FileIoOptions const& options = FileIoOptions()) const {
+        CODI_UNUSED(filename, options);
       }
 
       /// Do nothing.
-      void readFromFile(std::string const& filename) {
-        CODI_UNUSED(filename);
+      void readFromFile(std::string const& filename, FileIoOptions const& options = FileIoOptions()) {
+        CODI_UNUSED(filename, options);
       }
 
       /// Do nothing.
       void deleteData() {}
 
+      /// Do nothing.
+      void writeCheckpointToFile(std::string const& filename, bool newLog = false) {
+        CODI_UNUSED(filename, newLog);
+      }
+
+      /// Do nothing.
+      void readCheckpointsFromFile(std::string const& filename) {
+        CODI_UNUSED(filename);
+      }
+
       /// Empty set.
       std::set<TapeParameters> const& getAvailableParameters() const {
         return parameters;
@@ -176,10 +186,12 @@ namespace codi {
       /// @name ExternalFunctionTapeInterface interface implementation
       /// @{
 
-      /// Verifies tag properties.
+      /// Verifies tag properties. For the analysis, the value depends on all inputs.
       template<typename Lhs>
       Real registerExternalFunctionOutput(LhsExpressionInterface<Real, Gradient, TagTapeReverse, Lhs>& value) {
-        registerInput(value);
+        Base::setTag(value.cast().getIdentifier().tag);
+        Base::verifyRegisterValue(value, value.cast().getIdentifier());
+        Base::analyzeUnknownDependencies(value.cast().getIdentifier());
 
         return Real();
       }
@@ -300,6 +312,8 @@ namespace codi {
 
         Base::handleError(vi);
 
+        Base::analyzeStatement(lhs.cast().getIdentifier(), rhs, vi.isActive);
+
         if (vi.isActive) {
           Base::setTag(lhs.cast().getIdentifier().tag);
         } else {
@@ -320,6 +334,8 @@ namespace codi {
       CODI_INLINE void store(LhsExpressionInterface<Real, Gradient, TagTapeReverse, Lhs>& lhs, PassiveReal const& rhs) {
         Base::checkLhsError(lhs, rhs);
 
+        Base::analyzePassiveAssign(lhs.cast().getIdentifier());
+
         Base::resetTag(lhs.cast().getIdentifier().tag);
 
         lhs.cast().value() = rhs;
@@ -330,17 +346,25 @@ namespace codi {
       /// @name ManualStatementPushTapeInterface interface implementation
       /// @{
 
-      /// Do nothing.
-      void pushJacobiManual(Real const& jacobian, Real const& value, Identifier const& index) {
-        CODI_UNUSED(jacobian, value, index);
+      /// Collect dependencies for the analysis.
+      void pushJacobianManual(Real const& jacobian, Real const& value, Identifier const& index) {
+        CODI_UNUSED(jacobian, value);
+
+        Base::analyzeManualArgument(index);
+      }
+
+      /// See pushJacobianManual.
+      DEPRECATE(void pushJacobiManual(Real const& jacobian, Real const& value, Identifier const& index),
+                "Use pushJacobianManual.") {
+        pushJacobianManual(jacobian, value, index);
       }
 
       /// Set tag on lhs.
       void storeManual(Real const& lhsValue, Identifier& lhsIndex, Config::ArgumentSize const& size) {
-        CODI_UNUSED(lhsValue, size);
-
-        Base::checkLhsError(lhsValue, lhsIndex, lhsValue);
-        setTag(lhsIndex.tag);
+        Real value = lhsValue;
+        Base::checkLhsError(value, lhsIndex, lhsValue);
+        Base::analyzeManualStatement(lhsIndex, size);
+        Base::setTag(lhsIndex.tag);
       }
 
       /// @}
@@ -441,12 +465,14 @@ namespace codi {
       void registerInput(LhsExpressionInterface<Real, Gradient, TagTapeReverse, Lhs>& value) {
         Base::setTag(value.cast().getIdentifier().tag);
         Base::verifyRegisterValue(value, value.cast().getIdentifier());  // verification is mainly for the properties
+        Base::registerAnalysisInput(value);
       }
 
       /// Verify tag.
       template<typename Lhs>
       void registerOutput(LhsExpressionInterface<Real, Gradient, TagTapeReverse, Lhs>& value) {
         Base::verifyRegisterValue(value, value.cast().getIdentifier());
+        Base::registerAnalysisOutput(value);
       }
 
       /// Set tape to active.
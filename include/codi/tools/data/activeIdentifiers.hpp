@@ -0,0 +1,153 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Identifiers of active values whose primal values are stored in a separate array.
+   *
+   * Storage helper for containers that keep the primal values and the identifiers of T_Type in separate contiguous
+   * arrays, e.g. ActiveVector and TypeDispatchHelper. The primal values are owned by the container and passed to the
+   * functions that create or free identifiers, since the tape interface expects both.
+   *
+   * New entries are passive. Removed entries free their identifiers. The container has to keep the primal values of
+   * all entries that are affected by a call valid during the call.
+   *
+   * @tparam T_Type  The CoDiPack type of the entries.
+   */
+  template<typename T_Type>
+  struct ActiveIdentifiers {
+    public:
+
+      /// See ActiveIdentifiers.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+
+      using Real = typename Type::Real;              ///< See LhsExpressionInterface.
+      using Identifier = typename Type::Identifier;  ///< See LhsExpressionInterface.
+
+    private:
+
+      std::vector<Identifier> identifiers;
+
+    public:
+
+      /// Constructor
+      ActiveIdentifiers() : identifiers() {}
+
+      /// Move constructor. The identifiers are taken over, other is empty afterwards.
+      ActiveIdentifiers(ActiveIdentifiers&& other) : identifiers(std::move(other.identifiers)) {
+        other.identifiers.clear();
+      }
+
+      /// Move assignment. The identifiers are taken over, other is empty afterwards. This object has to be empty.
+      ActiveIdentifiers& operator=(ActiveIdentifiers&& other) {
+        codiAssert(identifiers.empty());
+
+        identifiers = std::move(other.identifiers);
+        other.identifiers.clear();
+        return *this;
+      }
+
+      ActiveIdentifiers(ActiveIdentifiers const&) = delete;             ///< Identifiers are not copyable.
+      ActiveIdentifiers& operator=(ActiveIdentifiers const&) = delete;  ///< Identifiers are not copyable.
+
+      /// Identifier of entry i.
+      CODI_INLINE Identifier& operator[](size_t i) {
+        return identifiers[i];
+      }
+
+      /// Identifier of entry i.
+      CODI_INLINE Identifier const& operator[](size_t i) const {
+        return identifiers[i];
+      }
+
+      /// Contiguous array of the identifiers.
+      CODI_INLINE Identifier* data() {
+        return identifiers.data();
+      }
+
+      /// Contiguous array of the identifiers.
+      CODI_INLINE Identifier const* data() const {
+        return identifiers.data();
+      }
+
+      /// Number of entries.
+      CODI_INLINE size_t size() const {
+        return identifiers.size();
+      }
+
+      /// Reserve memory for size entries.
+      void reserve(size_t size) {
+        identifiers.reserve(size);
+      }
+
+      /// Remove the entries from size on and free their identifiers. values holds the primal values of all entries.
+      void shrink(Real* values, size_t size) {
+        for (size_t i = size; i < identifiers.size(); ++i) {
+          Type::getTape().destroyIdentifier(values[i], identifiers[i]);
+        }
+        if (size < identifiers.size()) {
+          identifiers.resize(size);
+        }
+      }
+
+      /// Add passive entries up to size. values holds the primal values of the new entries.
+      void grow(Real* values, size_t size) {
+        size_t const oldSize = identifiers.size();
+        if (oldSize < size) {
+          identifiers.resize(size);
+        }
+        for (size_t i = oldSize; i < size; ++i) {
+          Type::getTape().initIdentifier(values[i], identifiers[i]);
+        }
+      }
+
+      /// Free the identifiers of the entries in [start, end) and make the entries passive.
+      void release(Real* values, size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+          Type::getTape().destroyIdentifier(values[i], identifiers[i]);
+          Type::getTape().initIdentifier(values[i], identifiers[i]);
+        }
+      }
+  };
+}
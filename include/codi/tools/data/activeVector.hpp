@@ -0,0 +1,207 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../../config.h"
+#include "../../expressions/activeTypeWrapper.hpp"
+#include "../../expressions/immutableActiveType.hpp"
+#include "../../misc/macros.hpp"
+#include "activeIdentifiers.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Vector of active values that stores the primal values and the identifiers in separate arrays.
+   *
+   * A std::vector<T_Type> is an array of structures, each entry holds a primal value and an identifier. Loops that only
+   * read the primal values can then not be vectorized and have to load the identifiers as well. ActiveVector stores all
+   * primal values in one contiguous array and all identifiers in a second one.
+   *
+   * Entries are accessed through proxies. operator[] returns an ActiveTypeWrapper that references the primal value and
+   * the identifier of the entry. It implements the LhsExpressionInterface, so assignments and expressions are recorded
+   * as for T_Type. The const operator[] returns an ImmutableActiveType. primalData() provides the contiguous primal
+   * values for loops that do not need to be recorded, e.g. the evaluation of a condition or of a passive part of a
+   * kernel.
+   *
+   * The identifiers are managed like the ones of T_Type. New entries are passive and the identifiers are freed on
+   * destruction. Copies are recorded element by element.
+   *
+   * @tparam T_Type  The CoDiPack type of the entries.
+   */
+  template<typename T_Type>
+  struct ActiveVector {
+    public:
+
+      /// See ActiveVector.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+
+      using Real = typename Type::Real;              ///< See LhsExpressionInterface.
+      using Identifier = typename Type::Identifier;  ///< See LhsExpressionInterface.
+
+      using Reference = ActiveTypeWrapper<Type>;        ///< Proxy for the mutable access to an entry.
+      using ConstReference = ImmutableActiveType<Type>;  ///< Proxy for the constant access to an entry.
+
+    private:
+
+      std::vector<Real> values;
+      ActiveIdentifiers<Type> identifiers;
+
+    public:
+
+      /// Constructor. All entries are passive and have the value v.
+      explicit ActiveVector(size_t size = 0, Real const& v = Real()) : values(), identifiers() {
+        resize(size, v);
+      }
+
+      /// Copy constructor. The copies are recorded.
+      ActiveVector(ActiveVector const& other) : values(), identifiers() {
+        assign(other);
+      }
+
+      /// Move constructor. Identifiers are taken over without recording.
+      ActiveVector(ActiveVector&& other) : values(std::move(other.values)), identifiers(std::move(other.identifiers)) {
+        other.values.clear();
+      }
+
+      /// Destructor. Frees all identifiers.
+      ~ActiveVector() {
+        resize(0);
+      }
+
+      /// Copy assignment. The copies are recorded.
+      ActiveVector& operator=(ActiveVector const& other) {
+        if (this != &other) {
+          assign(other);
+        }
+        return *this;
+      }
+
+      /// Move assignment. Identifiers are taken over without recording.
+      ActiveVector& operator=(ActiveVector&& other) {
+        if (this != &other) {
+          resize(0);
+          values = std::move(other.values);
+          identifiers = std::move(other.identifiers);
+          other.values.clear();
+        }
+        return *this;
+      }
+
+      /*******************************************************************************/
+      /// @name Element access
+      /// @{
+
+      /// Proxy for the entry i. Assignments to the proxy are recorded.
+      CODI_INLINE Reference operator[](size_t i) {
+        return Reference(values[i], identifiers[i]);
+      }
+
+      /// Immutable proxy for the entry i.
+      CODI_INLINE ConstReference operator[](size_t i) const {
+        return ConstReference(values[i], identifiers[i]);
+      }
+
+      /// Contiguous array of the primal values. Changes through this pointer are not recorded.
+      CODI_INLINE Real* primalData() {
+        return values.data();
+      }
+
+      /// Contiguous array of the primal values.
+      CODI_INLINE Real const* primalData() const {
+        return values.data();
+      }
+
+      /// Contiguous array of the identifiers.
+      CODI_INLINE Identifier const* identifierData() const {
+        return identifiers.data();
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Size management
+      /// @{
+
+      /// Number of entries.
+      CODI_INLINE size_t size() const {
+        return values.size();
+      }
+
+      /// True if there are no entries.
+      CODI_INLINE bool empty() const {
+        return values.empty();
+      }
+
+      /// Reserve memory for size entries.
+      void reserve(size_t size) {
+        values.reserve(size);
+        identifiers.reserve(size);
+      }
+
+      /// Change the number of entries. Removed entries free their identifiers, new entries are passive with value v.
+      void resize(size_t size, Real const& v = Real()) {
+        identifiers.shrink(values.data(), size);
+        values.resize(size, v);
+        identifiers.grow(values.data(), size);
+      }
+
+      /// Remove all entries.
+      void clear() {
+        resize(0);
+      }
+
+      /// Append an entry. The assignment is recorded.
+      template<typename Rhs>
+      void push_back(ExpressionInterface<Real, Rhs> const& rhs) {
+        resize(values.size() + 1);
+        (*this)[values.size() - 1] = rhs.cast();
+      }
+
+      /// @}
+
+    private:
+
+      void assign(ActiveVector const& other) {
+        resize(other.size());
+        for (size_t i = 0; i < other.size(); ++i) {
+          (*this)[i] = other[i];
+        }
+      }
+  };
+}
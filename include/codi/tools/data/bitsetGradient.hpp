@@ -0,0 +1,473 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../../traits/gradientTraits.hpp"
+#include "../../traits/realTraits.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Reference to a single bit of a BitsetGradient.
+   *
+   * Assigning a nonzero value sets the bit, assigning zero clears it. Updates with += and -= only set the bit. On
+   * conversion, the bit is reported as one or zero.
+   *
+   * @tparam T_Real  Scalar type that is used for reading and writing the bit.
+   */
+  template<typename T_Real>
+  struct BitsetGradientReference {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See BitsetGradientReference.
+
+    private:
+      uint64_t& word;
+      uint64_t mask;
+
+    public:
+
+      /// Constructor
+      CODI_INLINE BitsetGradientReference(uint64_t& word, uint64_t mask) : word(word), mask(mask) {}
+
+      /// Set the bit for nonzero values, otherwise clear it.
+      CODI_INLINE BitsetGradientReference& operator=(Real const& v) {
+        if (Real() != v) {
+          word |= mask;
+        } else {
+          word &= ~mask;
+        }
+
+        return *this;
+      }
+
+      /// Copy the bit value.
+      CODI_INLINE BitsetGradientReference& operator=(BitsetGradientReference const& o) {
+        return *this = (Real)o;
+      }
+
+      /// Set the bit for nonzero values.
+      CODI_INLINE BitsetGradientReference& operator+=(Real const& v) {
+        if (Real() != v) {
+          word |= mask;
+        }
+
+        return *this;
+      }
+
+      /// Set the bit for nonzero values.
+      CODI_INLINE BitsetGradientReference& operator-=(Real const& v) {
+        return *this += v;
+      }
+
+      /// One if the bit is set, zero otherwise.
+      CODI_INLINE operator Real() const {
+        return (Real)(0 != (word & mask));
+      }
+  };
+
+  /**
+   * @brief Bit pattern gradient for sparsity pattern detection.
+   *
+   * Can be used as the gradient template argument in active CoDiPack types, e.g.
+   * `ActiveType<ForwardEvaluation<double, BitsetGradient<64>>>` or `RealReverseIndexGen<double, BitsetGradient<64>>`.
+   * Each bit represents one input (forward mode) or one output (reverse mode). The arithmetic of the tapes maps to
+   * bit operations: additions and subtractions become a bitwise or, multiplications and divisions with a scalar keep
+   * the pattern and zero checks test all words at once. After an evaluation, the bits of an output (forward mode) or
+   * input (reverse mode) describe one row or column of the Jacobian sparsity pattern.
+   *
+   * Patterns are computed at the current evaluation point. A multiplication with an exact zero clears the pattern,
+   * which is consistent with the Jacobian tapes that drop zero Jacobians (Config::CheckJacobianIsZero). For a
+   * sparsity pattern that is independent of the point, evaluate at a point without accidental zeros.
+   *
+   * The width is fixed at compile time, since the gradient traits require a fixed dimension. Compute wider patterns
+   * by seeding several groups of inputs or outputs in successive evaluations.
+   *
+   * Statement evaluation events receive the pattern as an array of T_bits values. The tapes build this array only if
+   * Config::StatementEvents is enabled, which should be avoided for wide patterns.
+   *
+   * @tparam T_bits  Number of bits in the pattern.
+   * @tparam T_Real  Scalar type that is used by the tape and in element access.
+   */
+  template<size_t T_bits, typename T_Real = double>
+  struct BitsetGradient {
+    public:
+
+      static size_t constexpr bits = T_bits;  ///< See BitsetGradient.
+      using Real = CODI_DD(T_Real, double);   ///< See BitsetGradient.
+
+      static size_t constexpr WordBits = 64;                               ///< Number of bits per storage word.
+      static size_t constexpr Words = (bits + WordBits - 1) / WordBits;  ///< Number of storage words.
+
+      CODI_STATIC_ASSERT(0 != bits, "A bitset gradient requires at least one bit.");
+
+    private:
+      uint64_t words[Words];
+
+    public:
+
+      /// Constructor
+      CODI_INLINE BitsetGradient() : words() {}
+
+      /// Constructor. Sets all bits for a nonzero value.
+      CODI_INLINE BitsetGradient(Real const& s) : words() {
+        if (Real() != s) {
+          setAll();
+        }
+      }
+
+      /// Constructor
+      CODI_INLINE BitsetGradient(BitsetGradient const& v) : words() {
+        for (size_t i = 0; i < Words; ++i) {
+          words[i] = v.words[i];
+        }
+      }
+
+      /// Assignment operator.
+      CODI_INLINE BitsetGradient& operator=(BitsetGradient const& v) {
+        for (size_t i = 0; i < Words; ++i) {
+          words[i] = v.words[i];
+        }
+
+        return *this;
+      }
+
+      /// Per reference bit access.
+      CODI_INLINE BitsetGradientReference<Real> operator[](size_t const& i) {
+        return BitsetGradientReference<Real>(words[i / WordBits], mask(i));
+      }
+
+      /// Per value bit access. One if the bit is set, zero otherwise.
+      CODI_INLINE Real operator[](size_t const& i) const {
+        return (Real)test(i);
+      }
+
+      /// Update operator. Bitwise or.
+      CODI_INLINE BitsetGradient& operator+=(BitsetGradient const& v) {
+        for (size_t i = 0; i < Words; ++i) {
+          words[i] |= v.words[i];
+        }
+
+        return *this;
+      }
+
+      /// Update operator. Bitwise or, dependencies are never removed.
+      CODI_INLINE BitsetGradient& operator-=(BitsetGradient const& v) {
+        return *this += v;
+      }
+
+      /// Bitwise and.
+      CODI_INLINE BitsetGradient& operator&=(BitsetGradient const& v) {
+        for (size_t i = 0; i < Words; ++i) {
+          words[i] &= v.words[i];
+        }
+
+        return *this;
+      }
+
+      /*******************************************************************************/
+      /// @name Bit manipulation
+      /// @{
+
+      /// Set bit i.
+      CODI_INLINE void set(size_t i) {
+        words[i / WordBits] |= mask(i);
+      }
+
+      /// Set all bits.
+      CODI_INLINE void setAll() {
+        for (size_t i = 0; i < Words; ++i) {
+          words[i] = ~uint64_t(0);
+        }
+        if (0 != bits % WordBits) {
+          words[Words - 1] = (uint64_t(1) << (bits % WordBits)) - 1;
+        }
+      }
+
+      /// Clear bit i.
+      CODI_INLINE void reset(size_t i) {
+        words[i / WordBits] &= ~mask(i);
+      }
+
+      /// Clear all bits.
+      CODI_INLINE void reset() {
+        for (size_t i = 0; i < Words; ++i) {
+          words[i] = 0;
+        }
+      }
+
+      /// True if bit i is set.
+      CODI_INLINE bool test(size_t i) const {
+        return 0 != (words[i / WordBits] & mask(i));
+      }
+
+      /// True if at least one bit is set.
+      CODI_INLINE bool any() const {
+        uint64_t combined = 0;
+        for (size_t i = 0; i < Words; ++i) {
+          combined |= words[i];
+        }
+
+        return 0 != combined;
+      }
+
+      /// Number of set bits.
+      CODI_INLINE size_t count() const {
+        size_t total = 0;
+        for (size_t i = 0; i < Words; ++i) {
+          for (uint64_t w = words[i]; 0 != w; w &= w - 1) {
+            total += 1;
+          }
+        }
+
+        return total;
+      }
+
+      /// Storage word i.
+      CODI_INLINE uint64_t getWord(size_t i) const {
+        return words[i];
+      }
+
+      /// @}
+
+    private:
+
+      CODI_INLINE static uint64_t mask(size_t i) {
+        return uint64_t(1) << (i % WordBits);
+      }
+  };
+
+  template<size_t bits, typename Real>
+  size_t constexpr BitsetGradient<bits, Real>::bits;
+
+  template<size_t bits, typename Real>
+  size_t constexpr BitsetGradient<bits, Real>::WordBits;
+
+  template<size_t bits, typename Real>
+  size_t constexpr BitsetGradient<bits, Real>::Words;
+
+  /// Multiplication with a scalar. Keeps the pattern, unless the scalar is zero.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator*(Real const& s, BitsetGradient<bits, Real> const& v) {
+    if (Real() == s) {
+      return BitsetGradient<bits, Real>();
+    } else {
+      return v;
+    }
+  }
+
+  /// Multiplication with a passive scalar. Keeps the pattern, unless the scalar is zero.
+  template<size_t bits, typename Real, typename = RealTraits::EnableIfNotPassiveReal<Real>>
+  CODI_INLINE BitsetGradient<bits, Real> operator*(RealTraits::PassiveReal<Real> const& s,
+                                                   BitsetGradient<bits, Real> const& v) {
+    if (RealTraits::PassiveReal<Real>() == s) {
+      return BitsetGradient<bits, Real>();
+    } else {
+      return v;
+    }
+  }
+
+  /// Multiplication with a scalar. Keeps the pattern, unless the scalar is zero.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator*(BitsetGradient<bits, Real> const& v, Real const& s) {
+    return s * v;
+  }
+
+  /// Multiplication with a passive scalar. Keeps the pattern, unless the scalar is zero.
+  template<size_t bits, typename Real, typename = RealTraits::EnableIfNotPassiveReal<Real>>
+  CODI_INLINE BitsetGradient<bits, Real> operator*(BitsetGradient<bits, Real> const& v,
+                                                   RealTraits::PassiveReal<Real> const& s) {
+    return s * v;
+  }
+
+  /// Division by a scalar. Keeps the pattern.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator/(BitsetGradient<bits, Real> const& v, Real const& s) {
+    CODI_UNUSED(s);
+    return v;
+  }
+
+  /// Division by a passive scalar. Keeps the pattern.
+  template<size_t bits, typename Real, typename = RealTraits::EnableIfNotPassiveReal<Real>>
+  CODI_INLINE BitsetGradient<bits, Real> operator/(BitsetGradient<bits, Real> const& v,
+                                                   RealTraits::PassiveReal<Real> const& s) {
+    CODI_UNUSED(s);
+    return v;
+  }
+
+  /// Summation of two patterns. Bitwise or.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator+(BitsetGradient<bits, Real> const& v1,
+                                                   BitsetGradient<bits, Real> const& v2) {
+    BitsetGradient<bits, Real> r = v1;
+    r += v2;
+    return r;
+  }
+
+  /// Subtraction of two patterns. Bitwise or.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator-(BitsetGradient<bits, Real> const& v1,
+                                                   BitsetGradient<bits, Real> const& v2) {
+    return v1 + v2;
+  }
+
+  /// Negation. Keeps the pattern.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator-(BitsetGradient<bits, Real> const& v) {
+    return v;
+  }
+
+  /// Intersection of two patterns. Bitwise and.
+  template<size_t bits, typename Real>
+  CODI_INLINE BitsetGradient<bits, Real> operator&(BitsetGradient<bits, Real> const& v1,
+                                                   BitsetGradient<bits, Real> const& v2) {
+    BitsetGradient<bits, Real> r = v1;
+    r &= v2;
+    return r;
+  }
+
+  /// Test for equality. True if all bits match.
+  template<size_t bits, typename Real>
+  CODI_INLINE bool operator==(BitsetGradient<bits, Real> const& v1, BitsetGradient<bits, Real> const& v2) {
+    for (size_t i = 0; i < BitsetGradient<bits, Real>::Words; ++i) {
+      if (v1.getWord(i) != v2.getWord(i)) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /// Test for inequality. True if at least one bit differs.
+  template<size_t bits, typename Real>
+  CODI_INLINE bool operator!=(BitsetGradient<bits, Real> const& v1, BitsetGradient<bits, Real> const& v2) {
+    return !(v1 == v2);
+  }
+
+  /// Test for equality with a scalar. The scalar is converted with the scalar constructor.
+  template<typename A, size_t bits, typename Real>
+  CODI_INLINE bool operator==(A const& s, BitsetGradient<bits, Real> const& v) {
+    return BitsetGradient<bits, Real>((Real)s) == v;
+  }
+
+  /// Test for equality with a scalar. The scalar is converted with the scalar constructor.
+  template<typename A, size_t bits, typename Real>
+  CODI_INLINE bool operator==(BitsetGradient<bits, Real> const& v, A const& s) {
+    return s == v;
+  }
+
+  /// Test for inequality with a scalar. The scalar is converted with the scalar constructor.
+  template<typename A, size_t bits, typename Real>
+  CODI_INLINE bool operator!=(A const& s, BitsetGradient<bits, Real> const& v) {
+    return !(s == v);
+  }
+
+  /// Test for inequality with a scalar. The scalar is converted with the scalar constructor.
+  template<typename A, size_t bits, typename Real>
+  CODI_INLINE bool operator!=(BitsetGradient<bits, Real> const& v, A const& s) {
+    return !(s == v);
+  }
+
+  /// Output stream operator. Writes the bits with the lowest index first.
+  template<size_t bits, typename Real>
+  std::ostream& operator<<(std::ostream& os, BitsetGradient<bits, Real> const& v) {
+    for (size_t i = 0; i < bits; ++i) {
+      os << (v.test(i) ? '1' : '0');
+    }
+
+    return os;
+  }
+
+#ifndef DOXYGEN_DISABLE
+  template<size_t T_bits, typename T_Real>
+  struct RealTraits::IsTotalZero<BitsetGradient<T_bits, T_Real>> {
+    public:
+
+      using Type = BitsetGradient<T_bits, T_Real>;
+
+      static CODI_INLINE bool isTotalZero(Type const& v) {
+        return !v.any();
+      }
+  };
+
+  template<size_t T_bits, typename T_Real>
+  struct RealTraits::IsTotalFinite<BitsetGradient<T_bits, T_Real>> {
+    public:
+
+      using Type = BitsetGradient<T_bits, T_Real>;
+
+      static CODI_INLINE bool isTotalFinite(Type const& v) {
+        CODI_UNUSED(v);
+        return true;
+      }
+  };
+
+  namespace GradientTraits {
+
+    template<size_t T_bits, typename T_Real>
+    struct TraitsImplementation<BitsetGradient<T_bits, T_Real>> {
+      public:
+
+        using Gradient = BitsetGradient<T_bits, T_Real>;
+        using Real = T_Real;
+
+        static size_t constexpr dim = T_bits;
+
+        CODI_INLINE static BitsetGradientReference<Real> at(Gradient& gradient, size_t dim) {
+          return gradient[dim];
+        }
+
+        CODI_INLINE static Real at(Gradient const& gradient, size_t dim) {
+          return gradient[dim];
+        }
+
+        CODI_INLINE static std::array<Real, dim> toArray(Gradient const& gradient) {
+          std::array<Real, dim> result;
+          for (size_t i = 0; i < dim; ++i) {
+            result[i] = at(gradient, i);
+          }
+          return result;
+        }
+    };
+  }
+#endif
+}
@@ -0,0 +1,643 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <ostream>
+#include <type_traits>
+
+#include "../../config.h"
+#include "../../expressions/real/binaryOperators.hpp"
+#include "../../expressions/real/unaryOperators.hpp"
+#include "../../misc/exceptions.hpp"
+#include "../../misc/macros.hpp"
+#include "../../traits/expressionTraits.hpp"
+#include "../../traits/realTraits.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Fixed size pack of independent computation lanes.
+   *
+   * Can be used as the real and gradient template argument in active CoDiPack types, e.g.
+   * RealReverseGen<Pack<double, 8>>. Each operation on the active type then evaluates all lanes at once and is
+   * recorded as a single statement with one identifier for the whole pack; lane i of an identifier is the i-th entry
+   * of its adjoint. The Jacobians are packs as well, so the reverse sweep updates all lanes with one lane-wise
+   * multiply-add per argument. All lane loops have a compile time trip count and are left to the compiler for
+   * vectorization.
+   *
+   * The lanes are independent, operations that mix lanes are not supported. Comparisons reduce over the lanes (see
+   * the operators below), therefore branches in the program require that all lanes take the same branch. The
+   * functions with branching derivatives, i.e. abs, min, max, fmin, fmax, sqrt, cbrt and hypot, select the branch per
+   * lane for the value and the derivative.
+   *
+   * @tparam T_Real  Type of the lane entries.
+   * @tparam T_lanes  Number of lanes.
+   */
+  template<typename T_Real, size_t T_lanes>
+  struct Pack {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See Pack.
+
+      static size_t constexpr lanes = T_lanes;  ///< See Pack.
+
+    private:
+      Real data[lanes];
+
+    public:
+
+      /// Constructor
+      CODI_INLINE Pack() : data() {}
+
+      /// Constructor, broadcasts the value to all lanes.
+      CODI_INLINE Pack(Real const& s) : data() {
+        for (size_t i = 0; i < lanes; ++i) {
+          data[i] = s;
+        }
+      }
+
+      /// Constructor
+      CODI_INLINE Pack(std::initializer_list<Real> l) : data() {
+        size_t size = std::min(lanes, l.size());
+        Real const* array = l.begin();  // This is possible because the standard requires an array storage.
+        for (size_t i = 0; i < size; ++i) {
+          data[i] = array[i];
+        }
+      }
+
+      /// Per reference lane access.
+      CODI_INLINE Real& operator[](size_t const& i) {
+        return data[i];
+      }
+
+      /// Per value lane access.
+      CODI_INLINE Real const& operator[](size_t const& i) const {
+        return data[i];
+      }
+
+      /// Update operator.
+      CODI_INLINE Pack& operator+=(Pack const& v) {
+        for (size_t i = 0; i < lanes; ++i) {
+          data[i] += v.data[i];
+        }
+
+        return *this;
+      }
+
+      /// Update operator.
+      CODI_INLINE Pack& operator-=(Pack const& v) {
+        for (size_t i = 0; i < lanes; ++i) {
+          data[i] -= v.data[i];
+        }
+
+        return *this;
+      }
+
+      /// Update operator.
+      CODI_INLINE Pack& operator*=(Pack const& v) {
+        for (size_t i = 0; i < lanes; ++i) {
+          data[i] *= v.data[i];
+        }
+
+        return *this;
+      }
+
+      /// Update operator.
+      CODI_INLINE Pack& operator/=(Pack const& v) {
+        for (size_t i = 0; i < lanes; ++i) {
+          data[i] /= v.data[i];
+        }
+
+        return *this;
+      }
+  };
+
+  template<typename Real, size_t lanes>
+  size_t constexpr Pack<Real, lanes>::lanes;
+
+  /// If T is a Pack. Is either std::false_type or std::true_type.
+  template<typename T>
+  struct IsPack : std::false_type {};
+
+#ifndef DOXYGEN_DISABLE
+  template<typename Real, size_t lanes>
+  struct IsPack<Pack<Real, lanes>> : std::true_type {};
+#endif
+
+#define CODI_PACK_BINARY_OPERATOR(OP)                                                                   \
+  /** Lane-wise operator OP. */                                                                        \
+  template<typename Real, size_t lanes>                                                                \
+  CODI_INLINE Pack<Real, lanes> operator OP(Pack<Real, lanes> const& a, Pack<Real, lanes> const& b) {  \
+    Pack<Real, lanes> r;                                                                               \
+    for (size_t i = 0; i < lanes; ++i) {                                                               \
+      r[i] = a[i] OP b[i];                                                                             \
+    }                                                                                                  \
+    return r;                                                                                          \
+  }                                                                                                    \
+                                                                                                       \
+  /** Lane-wise operator OP with a broadcast scalar. */                                                \
+  template<typename Real, size_t lanes>                                                                \
+  CODI_INLINE Pack<Real, lanes> operator OP(Pack<Real, lanes> const& a, Real const& s) {               \
+    Pack<Real, lanes> r;                                                                               \
+    for (size_t i = 0; i < lanes; ++i) {                                                               \
+      r[i] = a[i] OP s;                                                                                \
+    }                                                                                                  \
+    return r;                                                                                          \
+  }                                                                                                    \
+                                                                                                       \
+  /** Lane-wise operator OP with a broadcast scalar. */                                                \
+  template<typename Real, size_t lanes>                                                                \
+  CODI_INLINE Pack<Real, lanes> operator OP(Real const& s, Pack<Real, lanes> const& b) {               \
+    Pack<Real, lanes> r;                                                                               \
+    for (size_t i = 0; i < lanes; ++i) {                                                               \
+      r[i] = s OP b[i];                                                                                \
+    }                                                                                                  \
+    return r;                                                                                          \
+  }
+
+  CODI_PACK_BINARY_OPERATOR(+)
+  CODI_PACK_BINARY_OPERATOR(-)
+  CODI_PACK_BINARY_OPERATOR(*)
+  CODI_PACK_BINARY_OPERATOR(/)
+
+#undef CODI_PACK_BINARY_OPERATOR
+
+  /// Negation.
+  template<typename Real, size_t lanes>
+  CODI_INLINE Pack<Real, lanes> operator-(Pack<Real, lanes> const& v) {
+    Pack<Real, lanes> r;
+    for (size_t i = 0; i < lanes; ++i) {
+      r[i] = -v[i];
+    }
+
+    return r;
+  }
+
+  /// Unary plus.
+  template<typename Real, size_t lanes>
+  CODI_INLINE Pack<Real, lanes> operator+(Pack<Real, lanes> const& v) {
+    return v;
+  }
+
+#define CODI_PACK_COMPARISON_OPERATOR(OP)                                                                            \
+  /** Lane-wise comparison OP. True if it holds for all lanes. */                                                   \
+  template<typename Real, size_t lanes>                                                                             \
+  CODI_INLINE bool operator OP(Pack<Real, lanes> const& a, Pack<Real, lanes> const& b) {                           \
+    for (size_t i = 0; i < lanes; ++i) {                                                                            \
+      if (!(a[i] OP b[i])) {                                                                                        \
+        return false;                                                                                               \
+      }                                                                                                             \
+    }                                                                                                               \
+    return true;                                                                                                    \
+  }                                                                                                                 \
+                                                                                                                    \
+  /** Lane-wise comparison OP with a scalar. True if it holds for all lanes. */                                     \
+  template<typename Real, size_t lanes>                                                                             \
+  CODI_INLINE bool operator OP(Pack<Real, lanes> const& a, Real const& s) {                                         \
+    return a OP Pack<Real, lanes>(s);                                                                               \
+  }                                                                                                                 \
+                                                                                                                    \
+  /** Lane-wise comparison OP with a scalar. True if it holds for all lanes. */                                     \
+  template<typename Real, size_t lanes>                                                                             \
+  CODI_INLINE bool operator OP(Real const& s, Pack<Real, lanes> const& b) {                                         \
+    return Pack<Real, lanes>(s) OP b;                                                                               \
+  }
+
+  CODI_PACK_COMPARISON_OPERATOR(==)
+  CODI_PACK_COMPARISON_OPERATOR(<)
+  CODI_PACK_COMPARISON_OPERATOR(<=)
+  CODI_PACK_COMPARISON_OPERATOR(>)
+  CODI_PACK_COMPARISON_OPERATOR(>=)
+
+#undef CODI_PACK_COMPARISON_OPERATOR
+
+  /// Lane-wise test for inequality. True if at least one lane differs.
+  template<typename Real, size_t lanes>
+  CODI_INLINE bool operator!=(Pack<Real, lanes> const& a, Pack<Real, lanes> const& b) {
+    return !(a == b);
+  }
+
+  /// Lane-wise test for inequality with a scalar. True if at least one lane differs.
+  template<typename Real, size_t lanes>
+  CODI_INLINE bool operator!=(Pack<Real, lanes> const& a, Real const& s) {
+    return !(a == s);
+  }
+
+  /// Lane-wise test for inequality with a scalar. True if at least one lane differs.
+  template<typename Real, size_t lanes>
+  CODI_INLINE bool operator!=(Real const& s, Pack<Real, lanes> const& b) {
+    return !(s == b);
+  }
+
+#define CODI_PACK_UNARY_FUNCTION(FUNC)                                    \
+  /** Lane-wise FUNC. */                                                 \
+  template<typename Real, size_t lanes>                                  \
+  CODI_INLINE Pack<Real, lanes> FUNC(Pack<Real, lanes> const& v) {       \
+    using std::FUNC;                                                     \
+    Pack<Real, lanes> r;                                                 \
+    for (size_t i = 0; i < lanes; ++i) {                                 \
+      r[i] = FUNC(v[i]);                                                 \
+    }                                                                    \
+    return r;                                                            \
+  }
+
+  CODI_PACK_UNARY_FUNCTION(abs)
+  CODI_PACK_UNARY_FUNCTION(fabs)
+  CODI_PACK_UNARY_FUNCTION(sqrt)
+  CODI_PACK_UNARY_FUNCTION(cbrt)
+  CODI_PACK_UNARY_FUNCTION(exp)
+  CODI_PACK_UNARY_FUNCTION(log)
+  CODI_PACK_UNARY_FUNCTION(log10)
+  CODI_PACK_UNARY_FUNCTION(sin)
+  CODI_PACK_UNARY_FUNCTION(cos)
+  CODI_PACK_UNARY_FUNCTION(tan)
+  CODI_PACK_UNARY_FUNCTION(sinh)
+  CODI_PACK_UNARY_FUNCTION(cosh)
+  CODI_PACK_UNARY_FUNCTION(tanh)
+  CODI_PACK_UNARY_FUNCTION(asin)
+  CODI_PACK_UNARY_FUNCTION(acos)
+  CODI_PACK_UNARY_FUNCTION(atan)
+  CODI_PACK_UNARY_FUNCTION(atanh)
+  CODI_PACK_UNARY_FUNCTION(erf)
+  CODI_PACK_UNARY_FUNCTION(erfc)
+
+#undef CODI_PACK_UNARY_FUNCTION
+
+#define CODI_PACK_BINARY_FUNCTION(FUNC)                                                              \
+  /** Lane-wise FUNC. */                                                                             \
+  template<typename Real, size_t lanes>                                                              \
+  CODI_INLINE Pack<Real, lanes> FUNC(Pack<Real, lanes> const& a, Pack<Real, lanes> const& b) {       \
+    using std::FUNC;                                                                                 \
+    Pack<Real, lanes> r;                                                                             \
+    for (size_t i = 0; i < lanes; ++i) {                                                             \
+      r[i] = FUNC(a[i], b[i]);                                                                       \
+    }                                                                                                \
+    return r;                                                                                        \
+  }                                                                                                  \
+                                                                                                     \
+  /** Lane-wise FUNC with a broadcast scalar. */                                                     \
+  template<typename Real, size_t lanes>                                                              \
+  CODI_INLINE Pack<Real, lanes> FUNC(Pack<Real, lanes> const& a, Real const& s) {                    \
+    return FUNC(a, Pack<Real, lanes>(s));                                                            \
+  }                                                                                                  \
+                                                                                                     \
+  /** Lane-wise FUNC with a broadcast scalar. */                                                     \
+  template<typename Real, size_t lanes>                                                              \
+  CODI_INLINE Pack<Real, lanes> FUNC(Real const& s, Pack<Real, lanes> const& b) {                    \
+    return FUNC(Pack<Real, lanes>(s), b);                                                            \
+  }
+
+  CODI_PACK_BINARY_FUNCTION(pow)
+  CODI_PACK_BINARY_FUNCTION(atan2)
+  CODI_PACK_BINARY_FUNCTION(hypot)
+  CODI_PACK_BINARY_FUNCTION(min)
+  CODI_PACK_BINARY_FUNCTION(max)
+  CODI_PACK_BINARY_FUNCTION(fmin)
+  CODI_PACK_BINARY_FUNCTION(fmax)
+
+#undef CODI_PACK_BINARY_FUNCTION
+
+  /// Expression type of Operation applied to two active values of type Active with Pack values. SFINAE fails for all
+  /// other types.
+  template<typename Active, template<typename> class Operation>
+  using ActivePackBinaryExpression =
+      typename std::enable_if<ExpressionTraits::IsLhsExpression<Active>::value && IsPack<typename Active::Real>::value,
+                              BinaryExpression<typename Active::Real, Active, Active, Operation>>::type;
+
+  /// max of two active values with Pack values. Needed since argument dependent lookup also finds std::max, which is
+  /// the better match for two arguments of the same type but compares all lanes at once.
+  template<template<typename> class Active, typename Inner>
+  CODI_INLINE ActivePackBinaryExpression<Active<Inner>, OperationMax> max(Active<Inner> const& a,
+                                                                          Active<Inner> const& b) {
+    return ActivePackBinaryExpression<Active<Inner>, OperationMax>(a, b);
+  }
+
+  /// min of two active values with Pack values. See max above.
+  template<template<typename> class Active, typename Inner>
+  CODI_INLINE ActivePackBinaryExpression<Active<Inner>, OperationMin> min(Active<Inner> const& a,
+                                                                          Active<Inner> const& b) {
+    return ActivePackBinaryExpression<Active<Inner>, OperationMin>(a, b);
+  }
+
+  /// Lane-wise modf.
+  template<typename Real, size_t lanes>
+  CODI_INLINE Pack<Real, lanes> modf(Pack<Real, lanes> const& v, Pack<Real, lanes>* integral) {
+    using std::modf;
+    Pack<Real, lanes> r;
+    for (size_t i = 0; i < lanes; ++i) {
+      r[i] = modf(v[i], &(*integral)[i]);
+    }
+
+    return r;
+  }
+
+  /// Output stream operator.
+  template<typename Real, size_t lanes>
+  std::ostream& operator<<(std::ostream& os, Pack<Real, lanes> const& v) {
+    os << "[";
+    for (size_t i = 0; i < lanes; ++i) {
+      if (i != 0) {
+        os << ", ";
+      }
+      os << v[i];
+    }
+    os << "]";
+
+    return os;
+  }
+
+  /*******************************************************************************/
+  /// @name Operations with branching derivatives
+  ///
+  /// The generic operations decide the branch with a comparison, which reduces over all lanes of a Pack. These
+  /// specializations decide it per lane.
+  /// @{
+
+  /// UnaryOperation implementation for abs of a Pack.
+  template<typename T_Real, size_t T_lanes>
+  struct OperationAbs<Pack<T_Real, T_lanes>> : public UnaryOperation<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Real = Pack<T_Real, T_lanes>;  ///< See UnaryOperation.
+
+      /// \copydoc UnaryOperation::primal
+      template<typename Arg>
+      static CODI_INLINE Real primal(Arg const& arg) {
+        return abs(arg);
+      }
+
+      /// \copydoc UnaryOperation::gradient
+      template<typename Arg>
+      static CODI_INLINE Real gradient(Arg const& arg, Real const& result) {
+        CODI_UNUSED(result);
+
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          if (arg[i] < 0.0) {
+            r[i] = -1.0;
+          } else if (arg[i] > 0.0) {
+            r[i] = 1.0;
+          } else {
+            r[i] = 0.0;
+          }
+        }
+        return r;
+      }
+  };
+
+  /// UnaryOperation implementation for cbrt of a Pack.
+  template<typename T_Real, size_t T_lanes>
+  struct OperationCbrt<Pack<T_Real, T_lanes>> : public UnaryOperation<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Real = Pack<T_Real, T_lanes>;  ///< See UnaryOperation.
+
+      /// \copydoc UnaryOperation::primal
+      template<typename Arg>
+      static CODI_INLINE Real primal(Arg const& arg) {
+        return cbrt(arg);
+      }
+
+      /// \copydoc UnaryOperation::gradient
+      template<typename Arg>
+      static CODI_INLINE Real gradient(Arg const& arg, Real const& result) {
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          if (Config::CheckExpressionArguments && 0.0 == arg[i]) {
+            CODI_EXCEPTION("Cbrt of zero value in lane %d.", (int)i);
+          }
+          if (result[i] != 0.0) {
+            r[i] = 1.0 / (3.0 * result[i] * result[i]);
+          } else {
+            r[i] = 0.0;
+          }
+        }
+        return r;
+      }
+  };
+
+  /// UnaryOperation implementation for sqrt of a Pack.
+  template<typename T_Real, size_t T_lanes>
+  struct OperationSqrt<Pack<T_Real, T_lanes>> : public UnaryOperation<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Real = Pack<T_Real, T_lanes>;  ///< See UnaryOperation.
+
+      /// \copydoc UnaryOperation::primal
+      template<typename Arg>
+      static CODI_INLINE Real primal(Arg const& arg) {
+        return sqrt(arg);
+      }
+
+      /// \copydoc UnaryOperation::gradient
+      template<typename Arg>
+      static CODI_INLINE Real gradient(Arg const& arg, Real const& result) {
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          if (Config::CheckExpressionArguments && 0.0 > arg[i]) {
+            CODI_EXCEPTION("Sqrt of negative value in lane %d.", (int)i);
+          }
+          if (result[i] != 0.0) {
+            r[i] = 0.5 / result[i];
+          } else {
+            r[i] = 0.0;
+          }
+        }
+        return r;
+      }
+  };
+
+  /// BinaryOperation implementation for hypot of a Pack.
+  template<typename T_Real, size_t T_lanes>
+  struct OperationHypot<Pack<T_Real, T_lanes>> : public BinaryOperation<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Real = Pack<T_Real, T_lanes>;  ///< See BinaryOperation.
+
+      /// \copydoc codi::BinaryOperation::primal()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real primal(ArgA const& argA, ArgB const& argB) {
+        return hypot(argA, argB);
+      }
+
+      /// \copydoc codi::BinaryOperation::gradientA()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real gradientA(ArgA const& argA, ArgB const& argB, Real const& result) {
+        CODI_UNUSED(argB);
+
+        return divideByResult(argA, result);
+      }
+
+      /// \copydoc codi::BinaryOperation::gradientB()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real gradientB(ArgA const& argA, ArgB const& argB, Real const& result) {
+        CODI_UNUSED(argA);
+
+        return divideByResult(argB, result);
+      }
+
+    private:
+      static CODI_INLINE Real divideByResult(Real const& arg, Real const& result) {
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          if (Config::CheckExpressionArguments && result[i] == 0.0) {
+            CODI_EXCEPTION("Zero divisor for hypot derivative in lane %d.", (int)i);
+          }
+          if (result[i] != 0.0) {
+            r[i] = arg[i] / result[i];
+          } else {
+            r[i] = 0.0;
+          }
+        }
+        return r;
+      }
+  };
+
+  /// BinaryOperation implementation for max and fmax of a Pack.
+  template<typename T_Real, size_t T_lanes>
+  struct OperationMax<Pack<T_Real, T_lanes>> : public BinaryOperation<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Real = Pack<T_Real, T_lanes>;  ///< See BinaryOperation.
+
+      /// \copydoc codi::BinaryOperation::primal()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real primal(ArgA const& argA, ArgB const& argB) {
+        return max(argA, argB);
+      }
+
+      /// \copydoc codi::BinaryOperation::gradientA()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real gradientA(ArgA const& argA, ArgB const& argB, Real const& result) {
+        CODI_UNUSED(result);
+
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          r[i] = argA[i] > argB[i] ? 1.0 : 0.0;
+        }
+        return r;
+      }
+
+      /// \copydoc codi::BinaryOperation::gradientB()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real gradientB(ArgA const& argA, ArgB const& argB, Real const& result) {
+        CODI_UNUSED(result);
+
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          r[i] = argA[i] > argB[i] ? 0.0 : 1.0;
+        }
+        return r;
+      }
+  };
+
+  /// BinaryOperation implementation for min and fmin of a Pack.
+  template<typename T_Real, size_t T_lanes>
+  struct OperationMin<Pack<T_Real, T_lanes>> : public BinaryOperation<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Real = Pack<T_Real, T_lanes>;  ///< See BinaryOperation.
+
+      /// \copydoc codi::BinaryOperation::primal()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real primal(ArgA const& argA, ArgB const& argB) {
+        return min(argA, argB);
+      }
+
+      /// \copydoc codi::BinaryOperation::gradientA()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real gradientA(ArgA const& argA, ArgB const& argB, Real const& result) {
+        CODI_UNUSED(result);
+
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          r[i] = argA[i] < argB[i] ? 1.0 : 0.0;
+        }
+        return r;
+      }
+
+      /// \copydoc codi::BinaryOperation::gradientB()
+      template<typename ArgA, typename ArgB>
+      static CODI_INLINE Real gradientB(ArgA const& argA, ArgB const& argB, Real const& result) {
+        CODI_UNUSED(result);
+
+        Real r;
+        for (size_t i = 0; i < T_lanes; ++i) {
+          r[i] = argA[i] < argB[i] ? 0.0 : 1.0;
+        }
+        return r;
+      }
+  };
+
+  /// @}
+
+#ifndef DOXYGEN_DISABLE
+  template<typename T_Real, size_t T_lanes>
+  struct RealTraits::IsTotalZero<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Type = Pack<T_Real, T_lanes>;
+
+      static CODI_INLINE bool isTotalZero(Type const& v) {
+        for (size_t i = 0; i < T_lanes; ++i) {
+          if (!codi::RealTraits::isTotalZero(v[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+  };
+
+  template<typename T_Real, size_t T_lanes>
+  struct RealTraits::IsTotalFinite<Pack<T_Real, T_lanes>> {
+    public:
+
+      using Type = Pack<T_Real, T_lanes>;
+
+      static CODI_INLINE bool isTotalFinite(Type const& v) {
+        for (size_t i = 0; i < T_lanes; ++i) {
+          if (!codi::RealTraits::isTotalFinite(v[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+  };
+#endif
+}
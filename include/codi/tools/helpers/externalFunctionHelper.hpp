@@ -208,9 +208,7 @@ namespace codi {
 
             for (size_t dim = 0; dim < ra->getVectorSize(); ++dim) {
               Synchronization::serialize([&]() {
-                for (size_t i = 0; i < inputIndices.size(); ++i) {
-                  x_d[i] = ra->getAdjoint(inputIndices[i], dim);
-                }
+                ra->gatherAdjoints(inputIndices.data(), inputIndices.size(), dim, x_d.data());
               });
 
               Synchronization::synchronize();
@@ -221,10 +219,8 @@ namespace codi {
               Synchronization::synchronize();
 
               Synchronization::serialize([&]() {
-                for (size_t i = 0; i < outputIndices.size(); ++i) {
-                  ra->resetAdjoint(outputIndices[i], dim);
-                  ra->updateAdjoint(outputIndices[i], dim, y_d[i]);
-                }
+                ra->resetAdjoints(outputIndices.data(), outputIndices.size(), dim);
+                ra->scatterAddAdjoints(outputIndices.data(), outputIndices.size(), dim, y_d.data());
               });
 
               Synchronization::synchronize();
@@ -292,10 +288,8 @@ namespace codi {
 
             for (size_t dim = 0; dim < ra->getVectorSize(); ++dim) {
               Synchronization::serialize([&]() {
-                for (size_t i = 0; i < outputIndices.size(); ++i) {
-                  y_b[i] = ra->getAdjoint(outputIndices[i], dim);
-                  ra->resetAdjoint(outputIndices[i], dim);
-                }
+                ra->gatherAdjoints(outputIndices.data(), outputIndices.size(), dim, y_b.data());
+                ra->resetAdjoints(outputIndices.data(), outputIndices.size(), dim);
               });
 
               Synchronization::synchronize();
@@ -306,9 +300,7 @@ namespace codi {
               Synchronization::synchronize();
 
               Synchronization::serialize([&]() {
-                for (size_t i = 0; i < inputIndices.size(); ++i) {
-                  ra->updateAdjoint(inputIndices[i], dim, x_b[i]);
-                }
+                ra->scatterAddAdjoints(inputIndices.data(), inputIndices.size(), dim, x_b.data());
               });
 
               Synchronization::synchronize();
@@ -333,17 +325,13 @@ namespace codi {
               }
 
               if (isReverse) {  // Provide result values for reverse evaluations.
-                for (size_t i = 0; i < outputIndices.size(); ++i) {
-                  outputValues[i] = ra->getPrimal(outputIndices[i]);
-                }
+                ra->gatherPrimals(outputIndices.data(), outputIndices.size(), outputValues.data());
               }
             }
 
             // Restore the old primals for reverse evaluations, before the inputs are read.
             if (isReverse && Tape::RequiresPrimalRestore) {
-              for (size_t i = 0; i < outputIndices.size(); ++i) {
-                ra->setPrimal(outputIndices[i], oldPrimals[i]);
-              }
+              ra->scatterPrimals(outputIndices.data(), outputIndices.size(), oldPrimals.data());
             }
 
             if (getPrimalsFromPrimalValueVector && provideInputValues) {
@@ -351,20 +339,16 @@ namespace codi {
                 inputValues.resize(inputIndices.size());
               }
 
-              for (size_t i = 0; i < inputIndices.size(); ++i) {
-                inputValues[i] = ra->getPrimal(inputIndices[i]);
-              }
+              ra->gatherPrimals(inputIndices.data(), inputIndices.size(), inputValues.data());
             }
           }
 
           CODI_INLINE void finalizeRun(VectorAccessInterface<Real, Identifier>* ra, bool isReverse = false) {
             if (getPrimalsFromPrimalValueVector && !isReverse) {
-              for (size_t i = 0; i < outputIndices.size(); ++i) {
-                if (Tape::RequiresPrimalRestore) {
-                  oldPrimals[i] = ra->getPrimal(outputIndices[i]);
-                }
-                ra->setPrimal(outputIndices[i], outputValues[i]);
+              if (Tape::RequiresPrimalRestore) {
+                ra->gatherPrimals(outputIndices.data(), outputIndices.size(), oldPrimals.data());
               }
+              ra->scatterPrimals(outputIndices.data(), outputIndices.size(), outputValues.data());
             }
 
             if (reallocatePrimalVectors) {
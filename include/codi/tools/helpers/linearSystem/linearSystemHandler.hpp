@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "../../../config.h"
@@ -270,6 +271,129 @@ namespace codi {
           }
       };
 
+      /*******************************************************************************/
+      // Bulk access to the vector interface.
+
+      /**
+       * @brief Contiguous identifiers and values for the bulk functions of the vector access interface.
+       *
+       * The functions with a reset give the same results as the element-wise functors ExtractAdjoint and SetTangent if
+       * an identifier appears several times, e.g. if the same variable is used twice in x. Only the first occurrence
+       * receives the extracted adjoint and only the last occurrence sets the tangent.
+       */
+      struct BulkBuffer {
+        public:
+
+          std::vector<Identifier> identifiers;  ///< Identifiers in iteration order.
+          std::vector<Real> values;             ///< Values in iteration order.
+          size_t pos;                           ///< Read position in values.
+
+          std::vector<size_t> order;  ///< Temporary for the detection of repeated identifiers.
+
+          /// Constructor.
+          BulkBuffer() : identifiers(), values(), pos(), order() {}
+
+          /// Remove all entries.
+          void clear() {
+            identifiers.clear();
+            values.clear();
+            pos = 0;
+          }
+
+          /// Get the adjoints of all identifiers with one call and rewind the read position.
+          void gatherAdjoints(VectorAccess* adjointInterface, size_t dim, bool reset) {
+            values.resize(identifiers.size());
+            adjointInterface->gatherAdjoints(identifiers.data(), identifiers.size(), dim, values.data());
+            if (reset) {
+              adjointInterface->resetAdjoints(identifiers.data(), identifiers.size(), dim);
+              zeroRepeatedValues(false);
+            }
+            pos = 0;
+          }
+
+          /// Update the adjoints of all identifiers with one call, optionally reset them before.
+          void scatterAddAdjoints(VectorAccess* adjointInterface, size_t dim, bool reset) {
+            if (reset) {
+              adjointInterface->resetAdjoints(identifiers.data(), identifiers.size(), dim);
+              zeroRepeatedValues(true);
+            }
+            adjointInterface->scatterAddAdjoints(identifiers.data(), identifiers.size(), dim, values.data());
+          }
+
+        private:
+
+          /// Set the values of repeated identifiers to zero. Either the first or the last occurrence keeps its value.
+          void zeroRepeatedValues(bool keepLast) {
+            order.resize(identifiers.size());
+            for (size_t i = 0; i < order.size(); i += 1) {
+              order[i] = i;
+            }
+            std::stable_sort(order.begin(), order.end(),
+                             [this](size_t a, size_t b) { return identifiers[a] < identifiers[b]; });
+
+            for (size_t i = 1; i < order.size(); i += 1) {
+              if (identifiers[order[i - 1]] == identifiers[order[i]]) {
+                values[keepLast ? order[i - 1] : order[i]] = Real();
+              }
+            }
+          }
+      };
+
+      /// Helper for the definition of functors based on a bulk buffer.
+      struct BulkBufferFunctor {
+        public:
+
+          BulkBuffer* buffer;  ///< Buffer handle.
+
+          /// Constructor.
+          BulkBufferFunctor(BulkBuffer* buffer) : buffer(buffer) {}
+      };
+
+      /// Collect value_id in the buffer.
+      struct CollectIdentifier : public BulkBufferFunctor {
+        public:
+          using BulkBufferFunctor::BulkBufferFunctor;
+
+          void operator()(Real& value, Identifier const& value_id) {
+            CODI_UNUSED(value);
+            this->buffer->identifiers.push_back(value_id);
+          }
+      };
+
+      /// Collect value_id and value in the buffer.
+      struct CollectIdentifierAndValue : public BulkBufferFunctor {
+        public:
+          using BulkBufferFunctor::BulkBufferFunctor;
+
+          void operator()(Real& value, Identifier const& value_id) {
+            this->buffer->identifiers.push_back(value_id);
+            this->buffer->values.push_back(value);
+          }
+      };
+
+      /// Set value to the next value in the buffer. The iteration order has to match the collection.
+      struct ReadValue : public BulkBufferFunctor {
+        public:
+          using BulkBufferFunctor::BulkBufferFunctor;
+
+          void operator()(Real& value, Identifier const& value_id) {
+            CODI_UNUSED(value_id);
+            value = this->buffer->values[this->buffer->pos];
+            this->buffer->pos += 1;
+          }
+      };
+
+      /// Collect mat_id and the adjoint update -x_v * b_b from the dyadic product in the buffer.
+      struct CollectDyadic : public BulkBufferFunctor {
+        public:
+          using BulkBufferFunctor::BulkBufferFunctor;
+
+          void operator()(Identifier& mat_id, Real const& x_v, Real const& b_b) {
+            this->buffer->identifiers.push_back(mat_id);
+            this->buffer->values.push_back(-x_v * b_b);
+          }
+      };
+
       /*******************************************************************************/
       // Detection of constant properties
 
@@ -361,14 +485,23 @@ namespace codi {
           data->lsi.iterateVector(SetPrimal(0, adjointInterface), data->oldPrimals, data->x_id);
         }
 
+        BulkBuffer buffer;
+
         size_t maxDim = adjointInterface->getVectorSize();
         for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
-          data->lsi.iterateVector(ExtractAdjoint(curDim, adjointInterface), x_b, data->x_id);
+          // Extract the adjoints of x.
+          buffer.clear();
+          data->lsi.iterateVector(CollectIdentifier(&buffer), x_b, data->x_id);
+          buffer.gatherAdjoints(adjointInterface, curDim, true);
+          data->lsi.iterateVector(ReadValue(&buffer), x_b, data->x_id);
 
           data->lsi.solveSystem(data->A_v_trans, x_b, s);
 
-          data->lsi.iterateDyadic(UpdateAdjointDyadic(curDim, adjointInterface), data->A_id, data->x_v, s);
-          data->lsi.iterateVector(UpdateAdjoint(curDim, adjointInterface), s, data->b_id);
+          // Update the adjoints of A and b.
+          buffer.clear();
+          data->lsi.iterateDyadic(CollectDyadic(&buffer), data->A_id, data->x_v, s);
+          data->lsi.iterateVector(CollectIdentifierAndValue(&buffer), s, data->b_id);
+          buffer.scatterAddAdjoints(adjointInterface, curDim, false);
         }
 
         data->lsi.deleteVectorReal(x_b);
@@ -402,14 +535,20 @@ namespace codi {
         VectorReal* b_d = data->lsi.createVectorReal(data->b_id);
         VectorReal* x_d = data->lsi.createVectorReal(data->x_id);
 
+        BulkBuffer buffer;
+
         size_t maxDim = adjointInterface->getVectorSize();
         for (size_t curDim = 0; curDim < maxDim; curDim += 1) {
           if (0 == curDim && updatePrimals) {
             data->lsi.iterateMatrix(GetPrimalAndGetTangent(curDim, adjointInterface), data->A_v, A_d, data->A_id);
             data->lsi.iterateVector(GetPrimalAndGetTangent(curDim, adjointInterface), b_v, b_d, data->b_id);
           } else {
-            data->lsi.iterateMatrix(GetTangent(curDim, adjointInterface), A_d, data->A_id);
-            data->lsi.iterateVector(GetTangent(curDim, adjointInterface), b_d, data->b_id);
+            buffer.clear();
+            data->lsi.iterateMatrix(CollectIdentifier(&buffer), A_d, data->A_id);
+            data->lsi.iterateVector(CollectIdentifier(&buffer), b_d, data->b_id);
+            buffer.gatherAdjoints(adjointInterface, curDim, false);
+            data->lsi.iterateMatrix(ReadValue(&buffer), A_d, data->A_id);
+            data->lsi.iterateVector(ReadValue(&buffer), b_d, data->b_id);
           }
 
           if (0 == curDim && updatePrimals) {  // Solve primal system only once and transposed setup only once.
@@ -435,7 +574,9 @@ namespace codi {
               data->lsi.iterateVector(SetPrimalAndSetTangent(curDim, adjointInterface), data->x_v, x_d, data->x_id);
             }
           } else {
-            data->lsi.iterateVector(SetTangent(curDim, adjointInterface), x_d, data->x_id);
+            buffer.clear();
+            data->lsi.iterateVector(CollectIdentifierAndValue(&buffer), x_d, data->x_id);
+            buffer.scatterAddAdjoints(adjointInterface, curDim, true);
           }
         }
 
@@ -35,6 +35,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "../../config.h"
@@ -45,11 +50,19 @@
 #include "../../traits/gradientTraits.hpp"
 #include "../../traits/tapeTraits.hpp"
 #include "../algorithms.hpp"
+#include "../data/bitsetGradient.hpp"
 #include "../data/jacobian.hpp"
 
 /** \copydoc codi::Namespace */
 namespace codi {
 
+  /// Selects how the PreaccumulationHelper computes the Jacobian of a code section.
+  enum class PreaccumulationMode {
+    Dense,     ///< Dense Jacobian, forward or reverse mode is chosen by the number of inputs and outputs.
+    Sparse,    ///< Sparsity pattern detection and compressed seeding.
+    Automatic  ///< Sparse mode if its estimated cost is lower than the one of the dense mode.
+  };
+
   /**
    * @brief Stores the Jacobian matrix for a code section.
    *
@@ -70,6 +83,28 @@ namespace codi {
    * evaluations are possible. This improves the performance of the helper since stack allocations are only performed
    * once.
    *
+   * By default, the Jacobian is computed with one sweep per input or output and stored as a dense matrix. Regions with
+   * many inputs and outputs but only a few nonzeros per row can use PreaccumulationMode::Sparse, see setMode(). The
+   * sparsity pattern is then detected with reverse sweeps that propagate one bit per output. Structurally orthogonal
+   * columns (forward mode) or rows (reverse mode) are grouped by a greedy coloring and seeded together. The mode with
+   * fewer sweeps is used and the statements are pushed directly from the sparse result. The sparse mode always
+   * evaluates the region on local adjoint arrays, see finishLocal(). PreaccumulationMode::Automatic uses the sparse mode
+   * for the first region of the helper in order to measure the colors and the density. Afterwards, it compares the
+   * expected cost of both approaches from the size of the recorded region and from the last measurement. The sparse
+   * mode requires a Jacobian tape and a region without low level functions, e.g. external functions. Otherwise, the
+   * dense mode is used.
+   *
+   * finishLocal() is an alternative to finish() that does not use the global adjoint vector. The identifiers of the
+   * region are mapped to a compact range and the region is evaluated on a small local adjoint array. This avoids the
+   * resize and locking of the global adjoint vector in multithreaded taping, as well as scattered memory accesses on
+   * tapes with index reuse.
+   *
+   * With setUseScratchTape(), the statements of a region are recorded into a scratch tape that is owned by the helper.
+   * The identifiers and the adjoint vector are still the ones of the main tape. The main tape only receives the
+   * preaccumulated statements, its data streams are never written and reset for the region. The scratch tape requires
+   * a Jacobian tape; on primal value tapes the region is always recorded on the main tape. The tape must not be
+   * deactivated inside a region that is recorded on the scratch tape.
+   *
    * @tparam T_Type  The CoDiPack type on which the evaluations take place.
    */
   template<typename T_Type, typename = void>
@@ -96,15 +131,133 @@ namespace codi {
 
     protected:
 
+      using GT = GradientTraits::TraitsImplementation<Gradient>;  ///< Shortcut for traits of gradient.
+
+      using PatternBits = BitsetGradient<64, Real>;  ///< Adjoint type for the sparsity pattern detection.
+
+      /// Sparsity detection and local adjoints require evaluations with custom adjoint vectors and identifier editing.
+      static bool constexpr CustomAdjointsAvailable = !Tape::HasPrimalValues;
+
+      /// Redirecting the recording requires swapRecordingData().
+      static bool constexpr ScratchTapeAvailable = !Tape::HasPrimalValues;
+
       Position startPos;                        ///< Starting position for the region.
       std::vector<Gradient> storedAdjoints;     ///< If adjoints of inputs should be stored, before the preaccumulation.
       JacobianCountNonZerosRow<Real> jacobian;  ///< Jacobian for the preaccumulation.
 
+      PreaccumulationMode mode;    ///< Mode for the Jacobian computation.
+      size_t startStatements;      ///< Number of statements on the tape at the start of the region.
+      size_t startLLFs;            ///< Number of low level functions on the tape at the start of the region.
+      Identifier startIdentifier;  ///< Largest identifier at the start of the region.
+
+      std::vector<PatternBits> patternAdjoints;             ///< Local adjoint vector for the sparsity detection.
+      std::vector<std::pair<size_t, size_t>> patternPairs;  ///< (output, input) pairs from the detection.
+      std::vector<size_t> rowStart;                         ///< CSR row start of the sparse Jacobian.
+      std::vector<size_t> rowColumns;                       ///< CSR input indices of the sparse Jacobian.
+      std::vector<Real> rowValues;                          ///< CSR values of the sparse Jacobian.
+      std::vector<size_t> columnStart;                      ///< CSC column start of the sparsity pattern.
+      std::vector<size_t> columnRows;                       ///< CSC output indices of the sparsity pattern.
+      std::vector<size_t> columnEntries;                    ///< CSR position of each CSC entry.
+      std::vector<size_t> columnColors;                     ///< Colors of the inputs for forward compression.
+      std::vector<size_t> rowColors;                        ///< Colors of the outputs for reverse compression.
+      std::vector<size_t> forbiddenColors;                  ///< Marker array for the coloring.
+
+      size_t measuredColors;   ///< Colors of the last sparse preaccumulation, zero if there was none.
+      double measuredDensity;  ///< Nonzero density of the last sparse preaccumulation.
+
+      std::unordered_map<Identifier, Identifier> localIdentifierMap;  ///< Global to local identifiers.
+      std::vector<Identifier> localInputs;                            ///< Local identifiers of the inputs.
+      std::vector<Identifier> localOutputs;                           ///< Local identifiers of the outputs.
+      std::vector<Gradient> localAdjoints;                            ///< Local adjoint vector.
+
+      bool useScratchTape;                 ///< If regions are recorded on the scratch tape.
+      bool recordingOnScratchTape;         ///< If the data of the main tape is currently swapped with the scratch tape.
+      std::unique_ptr<Tape> scratchTape;  ///< Scratch tape for the region, created on first use.
+
+      /// Adjoint access through a custom adjoint array. Identifiers are shifted by offset.
+      template<typename Adjoint>
+      struct ArrayAdjointAccess {
+          Tape& tape;     ///< Evaluated tape.
+          Adjoint* data;  ///< First entry of the array.
+          size_t offset;  ///< Identifier of the first entry.
+          size_t size;    ///< Number of entries.
+
+          /// Adjoint of an identifier.
+          Adjoint& operator[](Identifier const& identifier) {
+            return data[(size_t)identifier - offset];
+          }
+
+          /// Forward evaluation of [start, end].
+          void evaluateForward(Position const& start, Position const& end) {
+            tape.evaluateForward(start, end, data - offset);
+          }
+
+          /// Reverse evaluation of [start, end].
+          void evaluateReverse(Position const& start, Position const& end) {
+            tape.evaluate(start, end, data - offset);
+          }
+
+          /// Clear the whole array. The local identifiers of a region are compact, therefore all entries are used by the
+          /// region.
+          void clear() {
+            std::fill(data, data + size, Adjoint());
+          }
+      };
+
     public:
 
       /// Constructor
       PreaccumulationHelper()
-          : inputData(), outputData(), outputValues(), startPos(), storedAdjoints(), jacobian(0, 0) {}
+          : inputData(),
+            outputData(),
+            outputValues(),
+            startPos(),
+            storedAdjoints(),
+            jacobian(0, 0),
+            mode(PreaccumulationMode::Dense),
+            startStatements(0),
+            startLLFs(0),
+            startIdentifier(),
+            patternAdjoints(),
+            patternPairs(),
+            rowStart(),
+            rowColumns(),
+            rowValues(),
+            columnStart(),
+            columnRows(),
+            columnEntries(),
+            columnColors(),
+            rowColors(),
+            forbiddenColors(),
+            measuredColors(0),
+            measuredDensity(0.0),
+            localIdentifierMap(),
+            localInputs(),
+            localOutputs(),
+            localAdjoints(),
+            useScratchTape(false),
+            recordingOnScratchTape(false),
+            scratchTape() {}
+
+      /// Set the mode for the Jacobian computation. The default is PreaccumulationMode::Dense.
+      void setMode(PreaccumulationMode newMode) {
+        mode = newMode;
+      }
+
+      /// Get the mode for the Jacobian computation.
+      PreaccumulationMode getMode() const {
+        return mode;
+      }
+
+      /// Record the regions on a scratch tape owned by the helper instead of the main tape. The default is false.
+      void setUseScratchTape(bool use) {
+        useScratchTape = use;
+      }
+
+      /// If the regions are recorded on a scratch tape.
+      bool getUseScratchTape() const {
+        return useScratchTape;
+      }
 
       /// Add multiple additional inputs. Inputs need to be of type `Type`. Called after start().
       template<typename... Inputs>
@@ -128,7 +281,16 @@ namespace codi {
           outputData.clear();
           outputValues.clear();
 
+          beginScratchRecording(std::integral_constant<bool, ScratchTapeAvailable>());
+
           startPos = tape.getPosition();
+          if (PreaccumulationMode::Automatic == mode) {
+            startStatements = tape.getParameter(TapeParameters::StatementSize);
+          }
+          if (CustomAdjointsAvailable) {
+            startLLFs = tape.getParameter(TapeParameters::LLFInfoDataSize);
+            startIdentifier = (Identifier)tape.getParameter(TapeParameters::LargestIdentifier);
+          }
 
           addInputRecursive(inputs...);
         }
@@ -163,6 +325,50 @@ namespace codi {
           if (storeAdjoints) {
             restoreInputAdjoints();
           }
+        } else if (recordingOnScratchTape) {
+          resetRegion(false);
+        }
+
+        EventSystem<Tape>::notifyPreaccFinishListeners(tape);
+      }
+
+      /**
+       * @brief Finish the preaccumulation region and perform the preaccumulation on a local adjoint vector. See
+       * `addOutput()` for outputs.
+       *
+       * The identifiers stored in the region are replaced by a compact local range and the Jacobian is computed on a
+       * local adjoint array. The global adjoint vector is not resized, locked or accessed, therefore the adjoints of
+       * the inputs do not need to be stored.
+       *
+       * Requires a Jacobian tape and a region without low level functions. Otherwise, finish() with storeAdjoints = true
+       * is performed.
+       */
+      template<typename... Outputs>
+      void finishLocal(Outputs&... outputs) {
+        Tape& tape = Type::getTape();
+
+        if (tape.isActive()) {
+          addOutputRecursive(outputs...);
+
+          bool const useLocal = CustomAdjointsAvailable && regionHasNoLowLevelFunctions();
+
+          if (!useLocal) {
+            storeInputAdjoints();
+          }
+
+          tape.setPassive();
+          if (useLocal) {
+            doLocalPreaccumulation(std::integral_constant<bool, CustomAdjointsAvailable>());
+          } else {
+            doPreaccumulation();
+          }
+          tape.setActive();
+
+          if (!useLocal) {
+            restoreInputAdjoints();
+          }
+        } else if (recordingOnScratchTape) {
+          resetRegion(false);
         }
 
         EventSystem<Tape>::notifyPreaccFinishListeners(tape);
@@ -234,6 +440,40 @@ namespace codi {
       }
 
       void doPreaccumulation() {
+        if (useSparseMode()) {
+          // Sparse mode is only used if the region can be evaluated on local adjoint arrays.
+          doLocalPreaccumulation(std::integral_constant<bool, CustomAdjointsAvailable>());
+        } else {
+          doDensePreaccumulation();
+        }
+      }
+
+      /// True if the region contains no low level functions, e.g. external functions.
+      bool regionHasNoLowLevelFunctions() {
+        return startLLFs == Type::getTape().getParameter(TapeParameters::LLFInfoDataSize);
+      }
+
+      bool useSparseMode() {
+        if (!CustomAdjointsAvailable || PreaccumulationMode::Dense == mode || inputData.empty() ||
+            outputData.empty() || !regionHasNoLowLevelFunctions()) {
+          return false;
+        } else if (PreaccumulationMode::Sparse == mode || 0 == measuredColors) {
+          return true;  // Automatic mode measures the colors and the density in the first region.
+        }
+
+        // Automatic mode: Every sweep is one pass over the region. The sparse mode needs the detection sweeps and the
+        // compressed sweeps. Its bookkeeping is estimated with one unit per expected nonzero.
+        size_t constexpr gradDim = GT::dim;
+        size_t const regionSize = Type::getTape().getParameter(TapeParameters::StatementSize) - startStatements;
+        size_t const denseSweeps = (std::min(inputData.size(), outputData.size()) + gradDim - 1) / gradDim;
+        size_t const detectionSweeps = (outputData.size() + PatternBits::bits - 1) / PatternBits::bits;
+        size_t const compressedSweeps = (measuredColors + gradDim - 1) / gradDim;
+        size_t const expectedNonZeros = (size_t)(measuredDensity * inputData.size() * outputData.size());
+
+        return (detectionSweeps + compressedSweeps) * regionSize + expectedNonZeros < denseSweeps * regionSize;
+      }
+
+      void doDensePreaccumulation() {
         // Perform the accumulation of the tape part.
         Tape& tape = Type::getTape();
 
@@ -251,72 +491,448 @@ namespace codi {
                                                  AdjointsManagement::Manual);
 
         // Store the Jacobian matrix.
-        tape.resetTo(startPos, true, AdjointsManagement::Manual);
+        resetRegion(true);
 
         tape.endUseAdjointVector();
 
         for (size_t curOut = 0; curOut < outputData.size(); ++curOut) {
-          Type& value = *outputValues[curOut];
-          if (0 != jacobian.nonZerosRow(curOut)) {
-            int nonZerosLeft = jacobian.nonZerosRow(curOut);
-            jacobian.nonZerosRow(curOut) = 0;
-
-            // We need to initialize with the output's current identifier such that it is correctly deleted in
-            // storeManual.
-            Identifier lastIdentifier = value.getIdentifier();
-            bool staggeringActive = false;
-            int curIn = 0;
-
-            // Push statements as long as there are nonzeros left.
-            // If there are more than MaxStatementIntValue nonzeros, then we need to stagger the
-            // statement pushes:
-            // e.g. The reverse mode of w = f(u0, ..., u530) which is \bar u_i += df/du_i * \bar w for i = 0 ... 530 is
-            //      separated into
-            //        Statement 1:
-            //          \bar u_i += df/du_i * \bar t_1 for i = 0 ... 253   (254 entries)
-            //        Statement 2:
-            //          \bar t_1 += \bar w                                 (1 entry)
-            //          \bar u_i += df/du_i * \bar t_2 for i = 254 ... 506 (253 entries)
-            //        Statement 3:
-            //          \bar t_2 += \bar w                                 (1 entry)
-            //          \bar u_i += df/du_i * \bar w for i = 507 ... 530   (24 entries)
-            //
-            while (nonZerosLeft > 0) {
-              // Calculate the number of Jacobians for this statement.
-              int jacobiansForStatement = nonZerosLeft;
-              if (jacobiansForStatement > (int)Config::MaxArgumentSize) {
-                jacobiansForStatement = (int)Config::MaxArgumentSize - 1;
-                if (staggeringActive) {  // Except in the first round, one Jacobian is reserved for the staggering.
-                  jacobiansForStatement -= 1;
+          int nonZeros = jacobian.nonZerosRow(curOut);
+          jacobian.nonZerosRow(curOut) = 0;
+
+          int curIn = 0;
+          storeOutput(*outputValues[curOut], nonZeros, [&](Real& jac, Identifier& identifier) {
+            while (Real() == (Real)jacobian(curOut, curIn)) {
+              curIn += 1;
+            }
+            jac = jacobian(curOut, curIn);
+            identifier = inputData[curIn];
+            curIn += 1;
+          });
+        }
+      }
+
+      /// Fallback for tapes without custom adjoint vector evaluation.
+      void doLocalPreaccumulation(std::false_type) {
+        doDensePreaccumulation();
+      }
+
+      void doLocalPreaccumulation(std::true_type) {
+        Tape& tape = Type::getTape();
+
+        Position endPos = tape.getPosition();
+
+        size_t offset = 0;
+        size_t const localSize = mapLocalIdentifiers(endPos, offset);
+
+        // Identifiers that are not inputs may keep values from the last region, the local vectors are cleared.
+        localAdjoints.assign(localSize, Gradient());
+        if (useSparseMode()) {
+          patternAdjoints.assign(localSize, PatternBits());
+          ArrayAdjointAccess<PatternBits> patternAccess = {tape, patternAdjoints.data(), offset, localSize};
+          ArrayAdjointAccess<Gradient> adjointAccess = {tape, localAdjoints.data(), offset, localSize};
+
+          computeSparseJacobian(endPos, localInputs.data(), localOutputs.data(), patternAccess, adjointAccess);
+        } else {
+          ArrayAdjointAccess<Gradient> adjointAccess = {tape, localAdjoints.data(), offset, localSize};
+
+          computeDenseJacobianCompressed(endPos, localInputs.data(), localOutputs.data(), adjointAccess);
+        }
+
+        // The global adjoints of the region have not been used, the edited identifiers are removed with the region.
+        resetRegion(false);
+
+        storeSparseOutputs();
+      }
+
+      /**
+       * @brief Replaces the identifiers of the region with a compact local range.
+       *
+       * For linear index handling, the left hand side identifiers of the region are implicit and form the range
+       * (startIdentifier, endIdentifier]. All other identifiers are appended after this range. Otherwise, all
+       * identifiers are mapped to 1, 2, ... . The local identifiers of the inputs and outputs are stored in localInputs
+       * and localOutputs.
+       *
+       * @return The size of the local adjoint vector. Local identifiers are shifted by offset.
+       */
+      size_t mapLocalIdentifiers(Position const& endPos, size_t& offset) {
+        Tape& tape = Type::getTape();
+
+        Identifier const endIdentifier = (Identifier)tape.getParameter(TapeParameters::LargestIdentifier);
+        bool const linear = Tape::LinearIndexHandling;
+
+        Identifier nextIdentifier;
+        if (linear) {
+          offset = (size_t)startIdentifier;
+          nextIdentifier = endIdentifier + 1;
+        } else {
+          offset = 0;
+          nextIdentifier = 1;
+        }
+
+        localIdentifierMap.clear();
+        auto mapIdentifier = [&](Identifier& identifier) {
+          if (linear && startIdentifier < identifier && identifier <= endIdentifier) {
+            return;  // Left hand side of the region, already local.
+          }
+
+          typename std::unordered_map<Identifier, Identifier>::iterator pos = localIdentifierMap.find(identifier);
+          if (localIdentifierMap.end() == pos) {
+            pos = localIdentifierMap.insert(std::make_pair(identifier, nextIdentifier)).first;
+            nextIdentifier += 1;
+          }
+          identifier = pos->second;
+        };
+
+        tape.editIdentifiers(mapIdentifier, startPos, endPos);
+
+        localInputs.assign(inputData.begin(), inputData.end());
+        for (Identifier& identifier : localInputs) {
+          mapIdentifier(identifier);
+        }
+        localOutputs.assign(outputData.begin(), outputData.end());
+        for (Identifier& identifier : localOutputs) {
+          mapIdentifier(identifier);
+        }
+
+        return (size_t)nextIdentifier - offset;
+      }
+
+      /// Detects the sparsity pattern and computes the nonzeros with compressed seeding. The accesses need to be local
+      /// adjoint arrays.
+      template<typename PatternAccess, typename AdjointAccess>
+      void computeSparseJacobian(Position const& endPos, Identifier const* inputs, Identifier const* outputs,
+                                 PatternAccess& patternAccess, AdjointAccess& adjointAccess) {
+        size_t constexpr gradDim = GT::dim;
+
+        detectSparsity(endPos, inputs, outputs, patternAccess);
+
+        size_t const forwardColors =
+            colorGreedy(inputData.size(), columnStart, columnRows, rowStart, rowColumns, columnColors);
+        size_t const reverseColors =
+            colorGreedy(outputData.size(), rowStart, rowColumns, columnStart, columnRows, rowColors);
+
+        rowValues.assign(rowColumns.size(), Real());
+
+        if ((forwardColors + gradDim - 1) / gradDim <= (reverseColors + gradDim - 1) / gradDim) {
+          evaluateCompressedForward(endPos, inputs, outputs, forwardColors, adjointAccess);
+          measuredColors = forwardColors;
+        } else {
+          evaluateCompressedReverse(endPos, inputs, outputs, reverseColors, adjointAccess);
+          measuredColors = reverseColors;
+        }
+        measuredDensity = (double)rowColumns.size() / (double)(inputData.size() * outputData.size());
+      }
+
+      /// Computes all entries of the Jacobian. Each input or output gets its own color in the compressed evaluation.
+      template<typename AdjointAccess>
+      void computeDenseJacobianCompressed(Position const& endPos, Identifier const* inputs, Identifier const* outputs,
+                                          AdjointAccess& adjointAccess) {
+        size_t const inputSize = inputData.size();
+        size_t const outputSize = outputData.size();
+
+        patternPairs.clear();
+        for (size_t curOut = 0; curOut < outputSize; ++curOut) {
+          for (size_t curIn = 0; curIn < inputSize; ++curIn) {
+            patternPairs.push_back(std::make_pair(curOut, curIn));
+          }
+        }
+        buildPattern();
+
+        rowValues.assign(rowColumns.size(), Real());
+
+        if (Algorithms<Type>::EvaluationType::Forward ==
+            Algorithms<Type>::getEvaluationChoice(inputSize, outputSize)) {
+          columnColors.resize(inputSize);
+          for (size_t curIn = 0; curIn < inputSize; ++curIn) {
+            columnColors[curIn] = curIn;
+          }
+          evaluateCompressedForward(endPos, inputs, outputs, inputSize, adjointAccess);
+        } else {
+          rowColors.resize(outputSize);
+          for (size_t curOut = 0; curOut < outputSize; ++curOut) {
+            rowColors[curOut] = curOut;
+          }
+          evaluateCompressedReverse(endPos, inputs, outputs, outputSize, adjointAccess);
+        }
+      }
+
+      /// Computes the sparsity pattern in CSR and CSC format. Each reverse sweep propagates the bits of 64 outputs.
+      template<typename PatternAccess>
+      void detectSparsity(Position const& endPos, Identifier const* inputs, Identifier const* outputs,
+                          PatternAccess& patternAccess) {
+        size_t constexpr bits = PatternBits::bits;
+
+        patternPairs.clear();
+        for (size_t i = 0; i < outputData.size(); i += bits) {
+          size_t const blockEnd = std::min(outputData.size(), i + bits);
+          for (size_t curOut = i; curOut < blockEnd; ++curOut) {
+            patternAccess[outputs[curOut]].set(curOut - i);
+          }
+
+          patternAccess.evaluateReverse(endPos, startPos);
+
+          for (size_t curIn = 0; curIn < inputData.size(); ++curIn) {
+            PatternBits const& pattern = patternAccess[inputs[curIn]];
+            if (pattern.any()) {
+              for (size_t bit = 0; bit < blockEnd - i; ++bit) {
+                if (pattern.test(bit)) {
+                  patternPairs.push_back(std::make_pair(i + bit, curIn));
                 }
               }
-              nonZerosLeft -= jacobiansForStatement;  // Update nonzeros so that we know if it is the last round.
-
-              Identifier storedIdentifier = lastIdentifier;
-              // storeManual creates a new identifier which is either the identifier of the output w or the temporary
-              // staggering variables t_1, t_2, ...
-              tape.storeManual(value.getValue(), lastIdentifier, jacobiansForStatement + (int)staggeringActive);
-              if (staggeringActive) {  // Not the first staggering so push the last output.
-                tape.pushJacobianManual(1.0, 0.0, storedIdentifier);
+            }
+          }
+
+          // Also removes the bits of variables from outside of the region that were not declared as inputs.
+          patternAccess.clear();
+        }
+
+        // The pairs are ordered by input within each output block, therefore the columns of each row are sorted.
+        buildPattern();
+      }
+
+      /// Creates the CSR and CSC index structures from patternPairs.
+      void buildPattern() {
+        buildCompressedIndex(outputData.size(), patternPairs, rowStart, rowColumns, false);
+        buildCompressedIndex(inputData.size(), patternPairs, columnStart, columnRows, true);
+
+        columnEntries.resize(columnRows.size());
+        std::vector<size_t> columnPos(columnStart.begin(), columnStart.end() - 1);
+        for (size_t curOut = 0; curOut < outputData.size(); ++curOut) {
+          for (size_t k = rowStart[curOut]; k < rowStart[curOut + 1]; ++k) {
+            columnEntries[columnPos[rowColumns[k]]++] = k;
+          }
+        }
+      }
+
+      /// Counting sort of the pairs by the first (transposed == false) or second (transposed == true) index.
+      static void buildCompressedIndex(size_t size, std::vector<std::pair<size_t, size_t>> const& pairs,
+                                       std::vector<size_t>& start, std::vector<size_t>& entries, bool transposed) {
+        start.assign(size + 1, 0);
+        for (std::pair<size_t, size_t> const& p : pairs) {
+          start[(transposed ? p.second : p.first) + 1] += 1;
+        }
+        for (size_t i = 0; i < size; ++i) {
+          start[i + 1] += start[i];
+        }
+
+        entries.resize(pairs.size());
+        std::vector<size_t> pos(start.begin(), start.end() - 1);
+        for (std::pair<size_t, size_t> const& p : pairs) {
+          if (transposed) {
+            entries[pos[p.second]++] = p.first;
+          } else {
+            entries[pos[p.first]++] = p.second;
+          }
+        }
+      }
+
+      /// Greedy distance-2 coloring. Entities that share a neighbor get different colors. Returns the number of
+      /// colors.
+      size_t colorGreedy(size_t size, std::vector<size_t> const& start, std::vector<size_t> const& neighbors,
+                         std::vector<size_t> const& neighborStart, std::vector<size_t> const& neighborEntities,
+                         std::vector<size_t>& colors) {
+        size_t const noMark = (size_t)-1;
+        size_t colorCount = 0;
+
+        colors.assign(size, 0);
+        forbiddenColors.assign(size + 1, noMark);
+        for (size_t cur = 0; cur < size; ++cur) {
+          for (size_t k = start[cur]; k < start[cur + 1]; ++k) {
+            size_t const neighbor = neighbors[k];
+            for (size_t l = neighborStart[neighbor]; l < neighborStart[neighbor + 1]; ++l) {
+              size_t const other = neighborEntities[l];
+              if (other < cur) {
+                forbiddenColors[colors[other]] = cur;
               }
+            }
+          }
 
-              // Push the rest of the Jacobians for the statement.
-              while (jacobiansForStatement > 0) {
-                if (Real() != (Real)jacobian(curOut, curIn)) {
-                  tape.pushJacobianManual(jacobian(curOut, curIn), 0.0, inputData[curIn]);
-                  jacobiansForStatement -= 1;
-                }
-                curIn += 1;
+          size_t color = 0;
+          while (cur == forbiddenColors[color]) {
+            color += 1;
+          }
+          colors[cur] = color;
+          colorCount = std::max(colorCount, color + 1);
+        }
+
+        return colorCount;
+      }
+
+      /// Seeds all inputs of a color group in one vector dimension and reads the nonzeros of all outputs.
+      template<typename AdjointAccess>
+      void evaluateCompressedForward(Position const& endPos, Identifier const* inputs, Identifier const* outputs,
+                                     size_t colors, AdjointAccess& adjointAccess) {
+        size_t constexpr gradDim = GT::dim;
+        for (size_t c = 0; c < colors; c += gradDim) {
+          for (size_t curIn = 0; curIn < inputData.size(); ++curIn) {
+            if (columnColors[curIn] - c < gradDim) {
+              GT::at(adjointAccess[inputs[curIn]], columnColors[curIn] - c) = typename GT::Real(1.0);
+            }
+          }
+
+          adjointAccess.evaluateForward(startPos, endPos);
+
+          for (size_t curOut = 0; curOut < outputData.size(); ++curOut) {
+            Gradient const& gradient = adjointAccess[outputs[curOut]];
+            for (size_t k = rowStart[curOut]; k < rowStart[curOut + 1]; ++k) {
+              size_t const dim = columnColors[rowColumns[k]] - c;
+              if (dim < gradDim) {
+                rowValues[k] = GT::at(gradient, dim);
               }
+            }
+          }
+
+          // With index reuse, identifiers of variables from outside of the region can also be left hand sides in the
+          // region. Their tangents are removed for the next sweep.
+          adjointAccess.clear();
+        }
+      }
 
-              staggeringActive = true;
+      /// Seeds all outputs of a color group in one vector dimension and reads the nonzeros of all inputs.
+      template<typename AdjointAccess>
+      void evaluateCompressedReverse(Position const& endPos, Identifier const* inputs, Identifier const* outputs,
+                                     size_t colors, AdjointAccess& adjointAccess) {
+        size_t constexpr gradDim = GT::dim;
+        for (size_t c = 0; c < colors; c += gradDim) {
+          for (size_t curOut = 0; curOut < outputData.size(); ++curOut) {
+            if (rowColors[curOut] - c < gradDim) {
+              GT::at(adjointAccess[outputs[curOut]], rowColors[curOut] - c) = typename GT::Real(1.0);
             }
+          }
 
-            value.getIdentifier() = lastIdentifier; /* now set gradient data for the real output value */
-          } else {
-            // Disable tape index since there is no dependency.
-            tape.destroyIdentifier(value.value(), value.getIdentifier());
+          adjointAccess.evaluateReverse(endPos, startPos);
+
+          for (size_t curIn = 0; curIn < inputData.size(); ++curIn) {
+            Gradient const& gradient = adjointAccess[inputs[curIn]];
+            for (size_t k = columnStart[curIn]; k < columnStart[curIn + 1]; ++k) {
+              size_t const dim = rowColors[columnRows[k]] - c;
+              if (dim < gradDim) {
+                rowValues[columnEntries[k]] = GT::at(gradient, dim);
+              }
+            }
+          }
+
+          // Also removes the adjoints of variables from outside of the region that were not declared as inputs.
+          adjointAccess.clear();
+        }
+      }
+
+      /// Primal value tapes always record on the main tape.
+      void beginScratchRecording(std::false_type) {}
+
+      void beginScratchRecording(std::true_type) {
+        if (useScratchTape) {
+          if (nullptr == scratchTape) {
+            scratchTape.reset(new Tape());
+          }
+
+          Type::getTape().swapRecordingData(*scratchTape);
+          recordingOnScratchTape = true;
+        }
+      }
+
+      /// Primal value tapes always record on the main tape.
+      void endScratchRecording(std::false_type) {}
+
+      void endScratchRecording(std::true_type) {
+        if (recordingOnScratchTape) {
+          Type::getTape().swapRecordingData(*scratchTape);
+          recordingOnScratchTape = false;
+        }
+      }
+
+      /// Removes the region from the tape. Afterwards, the main tape records again.
+      void resetRegion(bool resetAdjoints) {
+        Tape& tape = Type::getTape();
+
+        tape.resetTo(startPos, resetAdjoints, AdjointsManagement::Manual);
+        endScratchRecording(std::integral_constant<bool, ScratchTapeAvailable>());
+      }
+
+      /// Stores the statements for all outputs from the CSR result.
+      void storeSparseOutputs() {
+        for (size_t curOut = 0; curOut < outputData.size(); ++curOut) {
+          int nonZeros = 0;
+          for (size_t k = rowStart[curOut]; k < rowStart[curOut + 1]; ++k) {
+            if (Real() != rowValues[k]) {
+              nonZeros += 1;
+            }
+          }
+
+          size_t k = rowStart[curOut];
+          storeOutput(*outputValues[curOut], nonZeros, [&](Real& jac, Identifier& identifier) {
+            while (Real() == rowValues[k]) {
+              k += 1;
+            }
+            jac = rowValues[k];
+            identifier = inputData[rowColumns[k]];
+            k += 1;
+          });
+        }
+      }
+
+      /// Stores the Jacobian row of one output on the tape. nextJacobian(jac, identifier) provides the next nonzero.
+      template<typename NextJacobian>
+      void storeOutput(Type& value, int nonZeros, NextJacobian&& nextJacobian) {
+        Tape& tape = Type::getTape();
+
+        if (0 != nonZeros) {
+          int nonZerosLeft = nonZeros;
+
+          // We need to initialize with the output's current identifier such that it is correctly deleted in
+          // storeManual.
+          Identifier lastIdentifier = value.getIdentifier();
+          bool staggeringActive = false;
+
+          // Push statements as long as there are nonzeros left.
+          // If there are more than MaxStatementIntValue nonzeros, then we need to stagger the
+          // statement pushes:
+          // e.g. The reverse mode of w = f(u0, ..., u530) which is \bar u_i += df/du_i * \bar w for i = 0 ... 530 is
+          //      separated into
+          //        Statement 1:
+          //          \bar u_i += df/du_i * \bar t_1 for i = 0 ... 253   (254 entries)
+          //        Statement 2:
+          //          \bar t_1 += \bar w                                 (1 entry)
+          //          \bar u_i += df/du_i * \bar t_2 for i = 254 ... 506 (253 entries)
+          //        Statement 3:
+          //          \bar t_2 += \bar w                                 (1 entry)
+          //          \bar u_i += df/du_i * \bar w for i = 507 ... 530   (24 entries)
+          //
+          while (nonZerosLeft > 0) {
+            // Calculate the number of Jacobians for this statement.
+            int jacobiansForStatement = nonZerosLeft;
+            if (jacobiansForStatement > (int)Config::MaxArgumentSize) {
+              jacobiansForStatement = (int)Config::MaxArgumentSize - 1;
+              if (staggeringActive) {  // Except in the first round, one Jacobian is reserved for the staggering.
+                jacobiansForStatement -= 1;
+              }
+            }
+            nonZerosLeft -= jacobiansForStatement;  // Update nonzeros so that we know if it is the last round.
+
+            Identifier storedIdentifier = lastIdentifier;
+            // storeManual creates a new identifier which is either the identifier of the output w or the temporary
+            // staggering variables t_1, t_2, ...
+            tape.storeManual(value.getValue(), lastIdentifier, jacobiansForStatement + (int)staggeringActive);
+            if (staggeringActive) {  // Not the first staggering so push the last output.
+              tape.pushJacobianManual(1.0, 0.0, storedIdentifier);
+            }
+
+            // Push the rest of the Jacobians for the statement.
+            while (jacobiansForStatement > 0) {
+              Real jac;
+              Identifier identifier;
+              nextJacobian(jac, identifier);
+              tape.pushJacobianManual(jac, 0.0, identifier);
+              jacobiansForStatement -= 1;
+            }
+
+            staggeringActive = true;
           }
+
+          value.getIdentifier() = lastIdentifier; /* now set gradient data for the real output value */
+        } else {
+          // Disable tape index since there is no dependency.
+          tape.destroyIdentifier(value.value(), value.getIdentifier());
         }
       }
   };
@@ -330,6 +946,28 @@ namespace codi {
   struct PreaccumulationHelperNoOpBase {
     public:
 
+      /// Does nothing.
+      void setMode(PreaccumulationMode newMode) {
+        CODI_UNUSED(newMode);
+        // Do nothing.
+      }
+
+      /// Always PreaccumulationMode::Dense.
+      PreaccumulationMode getMode() const {
+        return PreaccumulationMode::Dense;
+      }
+
+      /// Does nothing.
+      void setUseScratchTape(bool use) {
+        CODI_UNUSED(use);
+        // Do nothing.
+      }
+
+      /// Always false.
+      bool getUseScratchTape() const {
+        return false;
+      }
+
       /// Does nothing.
       template<typename... Inputs>
       void addInput(Inputs const&... inputs) {
@@ -357,6 +995,13 @@ namespace codi {
         CODI_UNUSED(storeAdjoints, outputs...);
         // Do nothing.
       }
+
+      /// Does nothing.
+      template<typename... Outputs>
+      void finishLocal(Outputs&... outputs) {
+        CODI_UNUSED(outputs...);
+        // Do nothing.
+      }
   };
 
   /// Specialize PreaccumulationHelper for forward tapes.
@@ -397,6 +1042,26 @@ namespace codi {
       /// Constructor.
       CODI_INLINE PreaccumulationHelper() = default;
 
+      /// Does nothing, tag tapes do not compute Jacobians.
+      void setMode(PreaccumulationMode newMode) {
+        CODI_UNUSED(newMode);
+      }
+
+      /// Always PreaccumulationMode::Dense.
+      PreaccumulationMode getMode() const {
+        return PreaccumulationMode::Dense;
+      }
+
+      /// Does nothing.
+      void setUseScratchTape(bool use) {
+        CODI_UNUSED(use);
+      }
+
+      /// Always false.
+      bool getUseScratchTape() const {
+        return false;
+      }
+
       /// Gathers the input values.
       template<typename... Inputs>
       void addInput(Inputs const&... inputs) {
@@ -452,6 +1117,12 @@ namespace codi {
         }
       }
 
+      /// Same as finish().
+      template<typename... Outputs>
+      void finishLocal(Outputs&... outputs) {
+        finish(false, outputs...);
+      }
+
     private:
 
       /// Terminator for the recursive implementation.
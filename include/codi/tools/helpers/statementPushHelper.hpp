@@ -34,6 +34,8 @@
  */
 #pragma once
 
+#include <type_traits>
+
 #include "../../config.h"
 #include "../../expressions/lhsExpressionInterface.hpp"
 #include "../../misc/macros.hpp"
@@ -112,6 +114,28 @@ namespace codi {
         cast().endPushStatement(lhs, primal);
       }
 
+      /**
+       * @brief Push several statements where the Jacobians are provided in compressed sparse row (CSR) format.
+       *
+       * Statement i computes lhs[i] = primals[i] with the arguments args[columns[k]] and the Jacobians jacobians[k]
+       * for k in [rowPointers[i], rowPointers[i + 1]). rowPointers has rows + 1 entries.
+       */
+      template<typename LhsVector, typename PrimalVector, typename ArgVector, typename RowVector, typename ColVector,
+               typename JacobiVector>
+      CODI_INLINE void pushStatementsCSR(LhsVector& lhs, PrimalVector const& primals, size_t const rows,
+                                         ArgVector const& args, RowVector const& rowPointers, ColVector const& columns,
+                                         JacobiVector const& jacobians) {
+        for (size_t row = 0; row < rows; ++row) {
+          cast().startPushStatement();
+
+          for (size_t k = (size_t)rowPointers[row]; k < (size_t)rowPointers[row + 1]; ++k) {
+            cast().pushArgument(args[columns[k]], jacobians[k]);
+          }
+
+          cast().endPushStatement(lhs[row], primals[row]);
+        }
+      }
+
       /// @}
 
     private:
@@ -146,6 +170,8 @@ namespace codi {
       /// See LhsExpressionInterface.
       using Tape = typename Type::Tape;
 
+      using Base = StatementPushHelperBase<Type, StatementPushHelper<Type>>;  ///< Base class abbreviation.
+
     protected:
       Identifier indexData[Config::MaxArgumentSize];  ///< Storage for the identifiers of the arguments.
       Real jacobianData[Config::MaxArgumentSize];     ///< Storage for the Jacobians of the arguments.
@@ -201,6 +227,43 @@ namespace codi {
       }
 
       /// @}
+      /*******************************************************************************/
+      /// @name Overwrite of StatementPushHelperBase methods
+      /// @{
+
+      /// \copydoc codi::StatementPushHelperBase::pushStatementsCSR <br><br>
+      /// Jacobian tapes store the statements in batches with one data reservation per batch. The checks for the
+      /// arguments are the same, but statements without arguments make their lhs passive.
+      template<typename LhsVector, typename PrimalVector, typename ArgVector, typename RowVector, typename ColVector,
+               typename JacobiVector>
+      CODI_INLINE void pushStatementsCSR(LhsVector& lhs, PrimalVector const& primals, size_t const rows,
+                                         ArgVector const& args, RowVector const& rowPointers, ColVector const& columns,
+                                         JacobiVector const& jacobians) {
+        pushStatementsCSRImpl(std::integral_constant<bool, TapeTraits::IsJacobianTape<Tape>::value>(), lhs, primals,
+                              rows, args, rowPointers, columns, jacobians);
+      }
+
+      /// @}
+
+    private:
+
+      /// Store the statements directly on Jacobian tapes.
+      template<typename LhsVector, typename PrimalVector, typename ArgVector, typename RowVector, typename ColVector,
+               typename JacobiVector>
+      CODI_INLINE void pushStatementsCSRImpl(std::true_type, LhsVector& lhs, PrimalVector const& primals,
+                                             size_t const rows, ArgVector const& args, RowVector const& rowPointers,
+                                             ColVector const& columns, JacobiVector const& jacobians) {
+        Type::getTape().storeManualCSR(lhs, primals, rows, args, rowPointers, columns, jacobians);
+      }
+
+      /// Push the statements one by one on other tapes.
+      template<typename LhsVector, typename PrimalVector, typename ArgVector, typename RowVector, typename ColVector,
+               typename JacobiVector>
+      CODI_INLINE void pushStatementsCSRImpl(std::false_type, LhsVector& lhs, PrimalVector const& primals,
+                                             size_t const rows, ArgVector const& args, RowVector const& rowPointers,
+                                             ColVector const& columns, JacobiVector const& jacobians) {
+        Base::pushStatementsCSR(lhs, primals, rows, args, rowPointers, columns, jacobians);
+      }
   };
 
 #ifndef DOXYGEN_DISABLE
@@ -293,6 +356,18 @@ namespace codi {
         endPushStatement(lhs, primal);
       }
 
+      /// \copydoc codi::StatementPushHelperBase::pushStatementsCSR
+      template<typename LhsVector, typename PrimalVector, typename ArgVector, typename RowVector, typename ColVector,
+               typename JacobiVector>
+      void pushStatementsCSR(LhsVector& lhs, PrimalVector const& primals, size_t const rows, ArgVector const& args,
+                             RowVector const& rowPointers, ColVector const& columns, JacobiVector const& jacobians) {
+        CODI_UNUSED(args, rowPointers, columns, jacobians);
+
+        for (size_t row = 0; row < rows; ++row) {
+          endPushStatement(lhs[row], primals[row]);
+        }
+      }
+
       /// @}
   };
 #endif
@@ -0,0 +1,475 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../config.h"
+#include "../../expressions/lhsExpressionInterface.hpp"
+#include "../../misc/macros.hpp"
+#include "../../tapes/interfaces/statementIteratorTapeInterface.hpp"
+#include "../../traits/realTraits.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Statistics and exports of recorded tapes.
+   *
+   * The inspector walks a tape with the StatementIteratorTapeInterface, currently implemented by the Jacobian tapes.
+   * The tape can be a live recording or a tape that was restored with readFromFile() or readCheckpointsFromFile().
+   *
+   * inspect() collects:
+   *  - the histogram of the number of arguments per statement,
+   *  - the distribution of identifier live ranges, i.e. the number of statements between the definition of an
+   *    identifier and its last use, grouped in powers of two,
+   *  - the number of uses of each identifier as an argument, see getHotIdentifiers(),
+   *  - the number of low level function calls and their data size per token,
+   *  - the number of bytes in each data stream of the tape.
+   *
+   * printStatistics() writes a report of these values. writeGraphviz() and writeJson() export a range of the tape.
+   * Statements are nodes in the Graphviz export, the arguments are edges labeled with the Jacobians. Since reuse index
+   * managers assign the same identifier multiple times, the nodes are named identifier_version. The JSON export writes
+   * the Jacobians with full precision, non-finite values are written as the strings "NaN", "Infinity" and "-Infinity".
+   *
+   * \code{.cpp}
+   *   codi::TapeInspector<codi::RealReverse> inspector;
+   *   inspector.inspect();
+   *   inspector.printStatistics(std::cout);
+   *   inspector.writeGraphviz(std::cout, start, end);
+   * \endcode
+   *
+   * @tparam T_Type  The CoDiPack type whose tape is inspected.
+   */
+  template<typename T_Type>
+  struct TapeInspector {
+    public:
+
+      /// See TapeInspector.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+
+      using Tape = typename Type::Tape;                   ///< See LhsExpressionInterface.
+      using Real = typename Type::Real;                   ///< See LhsExpressionInterface.
+      using Identifier = typename Type::Identifier;       ///< See LhsExpressionInterface.
+      using PassiveReal = RealTraits::PassiveReal<Real>;  ///< Basic computation type.
+      using Position = typename Tape::Position;           ///< See PositionalEvaluationTapeInterface.
+
+      /// Number of uses of an identifier as an argument.
+      struct IdentifierUses {
+        public:
+          Identifier identifier;  ///< Identifier.
+          size_t uses;            ///< Number of uses as an argument.
+      };
+
+      /// Number of calls and data size of the low level functions with the same token.
+      struct LowLevelFunctionUses {
+        public:
+          size_t calls;  ///< Number of calls.
+          size_t bytes;  ///< Total size of the data.
+      };
+
+    private:
+
+      /// Definition and last use of an identifier, measured in statements.
+      struct LiveRange {
+        public:
+          size_t definition;  ///< Statement that defines the identifier.
+          size_t lastUse;     ///< Last statement that uses the identifier.
+      };
+
+      Tape& tape;
+
+      size_t statements;
+      size_t inputs;
+      size_t arguments;
+      size_t lowLevelFunctions;
+      size_t lowLevelFunctionBytes;
+
+      std::map<size_t, size_t> argumentHistogram;
+      std::map<size_t, size_t> liveRangeHistogram;
+      std::map<Config::LowLevelFunctionToken, LowLevelFunctionUses> lowLevelFunctionTokens;
+      std::unordered_map<Identifier, size_t> identifierUses;
+      std::unordered_map<Identifier, LiveRange> liveRanges;
+
+    public:
+
+      /// Constructor
+      TapeInspector(Tape& tape = Type::getTape())
+          : tape(tape),
+            statements(),
+            inputs(),
+            arguments(),
+            lowLevelFunctions(),
+            lowLevelFunctionBytes(),
+            argumentHistogram(),
+            liveRangeHistogram(),
+            lowLevelFunctionTokens(),
+            identifierUses(),
+            liveRanges() {}
+
+      /*******************************************************************************/
+      /// @name Statistics
+      /// @{
+
+      /// Collect the statistics for the range [start, end] of the tape.
+      void inspect(Position const& start, Position const& end) {
+        clear();
+
+        tape.iterateForward(StatisticsCollector(*this), start, end);
+
+        for (auto const& range : liveRanges) {
+          addLiveRange(range.second);
+        }
+        liveRanges.clear();
+      }
+
+      /// Collect the statistics for the whole tape.
+      void inspect() {
+        inspect(tape.getZeroPosition(), tape.getPosition());
+      }
+
+      /// Number of statements, including inputs.
+      size_t getStatementCount() const {
+        return statements;
+      }
+
+      /// Number of inputs. Only recorded by tapes with a linear index management.
+      size_t getInputCount() const {
+        return inputs;
+      }
+
+      /// Total number of arguments of all statements.
+      size_t getArgumentCount() const {
+        return arguments;
+      }
+
+      /// Number of low level function calls, e.g. external functions.
+      size_t getLowLevelFunctionCount() const {
+        return lowLevelFunctions;
+      }
+
+      /// Maps the number of arguments to the number of statements with that many arguments.
+      std::map<size_t, size_t> const& getArgumentHistogram() const {
+        return argumentHistogram;
+      }
+
+      /// Maps k to the number of live ranges with a length in [2^k - 1, 2^(k + 1) - 1).
+      std::map<size_t, size_t> const& getLiveRangeHistogram() const {
+        return liveRangeHistogram;
+      }
+
+      /// Calls and data size per low level function token.
+      std::map<Config::LowLevelFunctionToken, LowLevelFunctionUses> const& getLowLevelFunctionTokens() const {
+        return lowLevelFunctionTokens;
+      }
+
+      /// The count identifiers that are used most often as arguments, in descending order.
+      std::vector<IdentifierUses> getHotIdentifiers(size_t count) const {
+        std::vector<IdentifierUses> hot;
+        hot.reserve(identifierUses.size());
+        for (auto const& entry : identifierUses) {
+          hot.push_back(IdentifierUses{entry.first, entry.second});
+        }
+
+        auto isHotter = [](IdentifierUses const& a, IdentifierUses const& b) {
+          return a.uses > b.uses || (a.uses == b.uses && a.identifier < b.identifier);
+        };
+
+        count = std::min(count, hot.size());
+        std::partial_sort(hot.begin(), hot.begin() + count, hot.end(), isHotter);
+        hot.resize(count);
+
+        return hot;
+      }
+
+      /// Bytes of the statement data stream.
+      size_t getStatementBytes() const {
+        size_t entrySize = sizeof(Config::ArgumentSize);
+        if (!Tape::LinearIndexHandling) {
+          entrySize += sizeof(Identifier);
+        }
+
+        return (statements + lowLevelFunctions) * entrySize;
+      }
+
+      /// Bytes of the Jacobian data stream.
+      size_t getJacobianBytes() const {
+        return arguments * (sizeof(Real) + sizeof(Identifier));
+      }
+
+      /// Bytes of the low level function info and data streams.
+      size_t getLowLevelFunctionBytes() const {
+        return lowLevelFunctions * (sizeof(Config::LowLevelFunctionToken) + sizeof(Config::LowLevelFunctionDataSize)) +
+               lowLevelFunctionBytes;
+      }
+
+      /// Write a report of the statistics from the last inspect() call.
+      void printStatistics(std::ostream& out = std::cout, size_t hotIdentifiers = 10) const {
+        std::string const hLine = "-------------------------------------------------------------\n";
+
+        out << hLine << "Tape inspection\n" << hLine;
+        out << "  Statements:          " << statements << "\n";
+        out << "  Inputs:              " << inputs << "\n";
+        out << "  Arguments:           " << arguments << "\n";
+        out << "  Low level functions: " << lowLevelFunctions << "\n";
+
+        out << hLine << "Bytes per data stream\n" << hLine;
+        out << "  Statement data:      " << getStatementBytes() << "\n";
+        out << "  Jacobian data:       " << getJacobianBytes() << "\n";
+        out << "  Low level functions: " << getLowLevelFunctionBytes() << "\n";
+
+        out << hLine << "Arguments per statement\n" << hLine;
+        for (auto const& entry : argumentHistogram) {
+          out << "  " << entry.first << ": " << entry.second << "\n";
+        }
+
+        out << hLine << "Identifier live ranges (statements)\n" << hLine;
+        for (auto const& entry : liveRangeHistogram) {
+          out << "  [" << ((size_t)1 << entry.first) - 1 << ", " << ((size_t)2 << entry.first) - 1 << "): " << entry.second
+              << "\n";
+        }
+
+        out << hLine << "Hot identifiers (uses as argument)\n" << hLine;
+        for (IdentifierUses const& entry : getHotIdentifiers(hotIdentifiers)) {
+          out << "  " << entry.identifier << ": " << entry.uses << "\n";
+        }
+
+        out << hLine << "Low level functions (token: calls, bytes)\n" << hLine;
+        for (auto const& entry : lowLevelFunctionTokens) {
+          out << "  " << (size_t)entry.first << ": " << entry.second.calls << ", " << entry.second.bytes << "\n";
+        }
+        out << hLine;
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Export
+      /// @{
+
+      /// Write the range [start, end] of the tape as a Graphviz graph.
+      void writeGraphviz(std::ostream& out, Position const& start, Position const& end) {
+        GraphvizWriter writer(out);
+
+        out << "digraph Tape {\n";
+        out << "  node [shape=box];\n";
+        tape.iterateForward(writer, start, end);
+        out << "}\n";
+      }
+
+      /// Write the range [start, end] of the tape as JSON.
+      void writeJson(std::ostream& out, Position const& start, Position const& end) {
+        JsonWriter writer(out);
+        std::streamsize precision = out.precision(std::numeric_limits<PassiveReal>::max_digits10);
+
+        out << "{\n  \"entries\": [";
+        tape.iterateForward(writer, start, end);
+        out << "\n  ]\n}\n";
+
+        out.precision(precision);
+      }
+
+      /// @}
+
+    private:
+
+      void clear() {
+        statements = 0;
+        inputs = 0;
+        arguments = 0;
+        lowLevelFunctions = 0;
+        lowLevelFunctionBytes = 0;
+
+        argumentHistogram.clear();
+        liveRangeHistogram.clear();
+        lowLevelFunctionTokens.clear();
+        identifierUses.clear();
+        liveRanges.clear();
+      }
+
+      void addLiveRange(LiveRange const& range) {
+        size_t length = range.lastUse - range.definition + 1;
+        size_t bucket = 0;
+        while (length > 1) {
+          length /= 2;
+          bucket += 1;
+        }
+
+        liveRangeHistogram[bucket] += 1;
+      }
+
+      /// Collects the statistics of inspect().
+      struct StatisticsCollector {
+        public:
+
+          TapeInspector& inspector;
+
+          StatisticsCollector(TapeInspector& inspector) : inspector(inspector) {}
+
+          void handleStatement(Identifier const& lhsIdentifier, Config::ArgumentSize const& size, Real const* jacobians,
+                               Identifier const* rhsIdentifiers) {
+            CODI_UNUSED(jacobians);
+
+            size_t const curStatement = inspector.statements;
+            inspector.statements += 1;
+            if (0 == size) {
+              inspector.inputs += 1;
+            } else {
+              inspector.argumentHistogram[size] += 1;
+              inspector.arguments += size;
+            }
+
+            for (Config::ArgumentSize i = 0; i < size; i += 1) {
+              inspector.identifierUses[rhsIdentifiers[i]] += 1;
+
+              auto range = inspector.liveRanges.find(rhsIdentifiers[i]);
+              if (inspector.liveRanges.end() == range) {
+                // Defined outside of the inspected range.
+                inspector.liveRanges[rhsIdentifiers[i]] = LiveRange{curStatement, curStatement};
+              } else {
+                range->second.lastUse = curStatement;
+              }
+            }
+
+            auto range = inspector.liveRanges.find(lhsIdentifier);
+            if (inspector.liveRanges.end() != range) {
+              // The identifier is reused, its previous live range ends here.
+              inspector.addLiveRange(range->second);
+              range->second = LiveRange{curStatement, curStatement};
+            } else {
+              inspector.liveRanges[lhsIdentifier] = LiveRange{curStatement, curStatement};
+            }
+          }
+
+          void handleLowLevelFunction(Config::LowLevelFunctionToken const& token, size_t const& dataSize) {
+            inspector.lowLevelFunctions += 1;
+            inspector.lowLevelFunctionBytes += dataSize;
+
+            LowLevelFunctionUses& uses = inspector.lowLevelFunctionTokens[token];
+            uses.calls += 1;
+            uses.bytes += dataSize;
+          }
+      };
+
+      /// Names the statement nodes identifier_version.
+      struct GraphvizWriter {
+        public:
+
+          std::ostream& out;
+          std::unordered_map<Identifier, size_t> versions;
+          size_t lowLevelFunctions;
+
+          GraphvizWriter(std::ostream& out) : out(out), versions(), lowLevelFunctions() {}
+
+          std::string nodeName(Identifier const& identifier) {
+            return "\"" + std::to_string(identifier) + "_" + std::to_string(versions[identifier]) + "\"";
+          }
+
+          void handleStatement(Identifier const& lhsIdentifier, Config::ArgumentSize const& size, Real const* jacobians,
+                               Identifier const* rhsIdentifiers) {
+            // The arguments refer to the previous version of a reused left hand side identifier.
+            std::vector<std::string> rhsNames(size);
+            for (Config::ArgumentSize i = 0; i < size; i += 1) {
+              rhsNames[i] = nodeName(rhsIdentifiers[i]);
+            }
+
+            if (versions.end() != versions.find(lhsIdentifier)) {
+              versions[lhsIdentifier] += 1;
+            }
+
+            std::string lhsName = nodeName(lhsIdentifier);
+            out << "  " << lhsName << " [label=\"" << lhsIdentifier << "\"];\n";
+            for (Config::ArgumentSize i = 0; i < size; i += 1) {
+              out << "  " << rhsNames[i] << " -> " << lhsName << " [label=\""
+                  << RealTraits::getPassiveValue(jacobians[i]) << "\"];\n";
+            }
+          }
+
+          void handleLowLevelFunction(Config::LowLevelFunctionToken const& token, size_t const& dataSize) {
+            out << "  \"llf_" << lowLevelFunctions << "\" [shape=ellipse, label=\"Low level function " << (size_t)token
+                << "\\n" << dataSize << " bytes\"];\n";
+            lowLevelFunctions += 1;
+          }
+      };
+
+      /// One entry per statement or low level function.
+      struct JsonWriter {
+        public:
+
+          std::ostream& out;
+          bool first;
+
+          JsonWriter(std::ostream& out) : out(out), first(true) {}
+
+          void nextEntry() {
+            out << (first ? "\n    " : ",\n    ");
+            first = false;
+          }
+
+          void writeNumber(PassiveReal const& value) {
+            if (std::isnan(value)) {
+              out << "\"NaN\"";
+            } else if (std::isinf(value)) {
+              out << (value > 0 ? "\"Infinity\"" : "\"-Infinity\"");
+            } else {
+              out << value;
+            }
+          }
+
+          void handleStatement(Identifier const& lhsIdentifier, Config::ArgumentSize const& size, Real const* jacobians,
+                               Identifier const* rhsIdentifiers) {
+            nextEntry();
+            out << "{\"lhs\": " << lhsIdentifier << ", \"arguments\": [";
+            for (Config::ArgumentSize i = 0; i < size; i += 1) {
+              out << (0 == i ? "" : ", ") << "{\"identifier\": " << rhsIdentifiers[i] << ", \"jacobian\": ";
+              writeNumber(RealTraits::getPassiveValue(jacobians[i]));
+              out << "}";
+            }
+            out << "]}";
+          }
+
+          void handleLowLevelFunction(Config::LowLevelFunctionToken const& token, size_t const& dataSize) {
+            nextEntry();
+            out << "{\"lowLevelFunction\": " << (size_t)token << ", \"bytes\": " << dataSize << "}";
+          }
+      };
+  };
+}
@@ -0,0 +1,385 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../config.h"
+#include "../../expressions/activeTypeWrapper.hpp"
+#include "../../misc/exceptions.hpp"
+#include "../../misc/macros.hpp"
+#include "../../traits/realTraits.hpp"
+#include "../data/activeIdentifiers.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief View of the data of a TypeDispatchHelper as active values of type T_Type.
+   *
+   * Entries are accessed through ActiveTypeWrapper objects that reference the primal value and the identifier in the
+   * separate arrays of the helper. Assignments to the entries are recorded on the tape of T_Type.
+   *
+   * @tparam T_Type  The active type of the view.
+   * @tparam T_IsPassive  True if T_Type is the primal type of the helper.
+   */
+  template<typename T_Type, bool T_IsPassive = false>
+  struct TypeDispatchView {
+    public:
+
+      /// See TypeDispatchView.
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+
+      using Real = typename Type::Real;              ///< See LhsExpressionInterface.
+      using Identifier = typename Type::Identifier;  ///< See LhsExpressionInterface.
+      using Reference = ActiveTypeWrapper<Type>;     ///< Type of the entries.
+
+      static bool constexpr IsPassive = false;  ///< If the view is on the primal values only.
+
+    private:
+
+      Real* values;
+      Identifier* identifiers;
+      size_t count;
+
+    public:
+
+      /// Constructor
+      TypeDispatchView(Real* values, Identifier* identifiers, size_t count)
+          : values(values), identifiers(identifiers), count(count) {}
+
+      /// Access an entry.
+      CODI_INLINE Reference operator[](size_t i) const {
+        return Reference(values[i], identifiers[i]);
+      }
+
+      /// Primal values of the entries. Values must not be changed through this pointer while they are active.
+      CODI_INLINE Real const* primalData() const {
+        return values;
+      }
+
+      /// Number of entries.
+      CODI_INLINE size_t size() const {
+        return count;
+      }
+  };
+
+  /**
+   * @brief View of the data of a TypeDispatchHelper as plain primal values.
+   *
+   * The entries are references to the primal array of the helper. No identifiers are accessed.
+   *
+   * @tparam T_Type  The primal type of the helper.
+   */
+  template<typename T_Type>
+  struct TypeDispatchView<T_Type, true> {
+    public:
+
+      using Type = CODI_DD(T_Type, double);  ///< See TypeDispatchView.
+
+      using Real = Type;        ///< Primal type.
+      using Reference = Type&;  ///< Type of the entries.
+
+      static bool constexpr IsPassive = true;  ///< If the view is on the primal values only.
+
+    private:
+
+      Real* values;
+      size_t count;
+
+    public:
+
+      /// Constructor
+      TypeDispatchView(Real* values, size_t count) : values(values), count(count) {}
+
+      /// Access an entry.
+      CODI_INLINE Reference operator[](size_t i) const {
+        return values[i];
+      }
+
+      /// Contiguous array of the entries.
+      CODI_INLINE Real* data() const {
+        return values;
+      }
+
+      /// Number of entries.
+      CODI_INLINE size_t size() const {
+        return count;
+      }
+  };
+
+  /**
+   * @brief Stores a state vector once and provides it as primal values or as one of several active types. Selects the
+   * type of a computation at runtime.
+   *
+   * Solvers that are templated on the computation type often switch at runtime between a plain primal evaluation and
+   * evaluations with different CoDiPack types, e.g. per time step. With separate instantiations, the state is stored
+   * once per type and has to be converted at every switch. This helper stores the primal values in one contiguous
+   * array and the identifiers of each active type in a separate array. All types operate on the same primal values
+   * through views, see TypeDispatchView:
+   *  - The view of T_Real gives direct access to the primal array, e.g. for passing it to a library.
+   *  - The views of the active types wrap the primal value and the identifier of an entry in an ActiveTypeWrapper.
+   *
+   * The type is selected with setType() or setTypeIndex() (0 is T_Real, i is the i-th active type).
+   * dispatch() calls a function object with the view of the selected type:
+   * \code{.cpp}
+   *   struct TimeStep {
+   *     template<typename View>
+   *     void operator()(View const& state, double dt) {
+   *       // View::Reference is double& or an ActiveTypeWrapper, the step is instantiated for all types.
+   *     }
+   *   };
+   *
+   *   codi::TypeDispatchHelper<double, codi::RealReverse, codi::RealForwardVec<4>> helper(n);
+   *   helper.setType<codi::RealReverse>();
+   *   helper.dispatch(TimeStep(), dt);
+   * \endcode
+   *
+   * A switch of the type does not convert the primal values. Only the identifiers of the previously selected active
+   * type are released and reset to passive ones, since the primal values are changed by the other types without
+   * updating them. Therefore, the identifiers of all active types that are not selected are always passive.
+   *
+   * All active types need to have T_Real as their primal type.
+   *
+   * @tparam T_Real         The primal type. Usually double or, for nested types, the primal type of the outer type.
+   * @tparam T_ActiveTypes  The CoDiPack types that can be selected.
+   */
+  template<typename T_Real, typename... T_ActiveTypes>
+  struct TypeDispatchHelper {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See TypeDispatchHelper.
+
+      /// Number of types that can be selected, including Real.
+      static size_t constexpr TypeCount = sizeof...(T_ActiveTypes) + 1;
+
+      /// Type at position pos. 0 is Real, i is the i-th active type.
+      template<size_t pos>
+      using TypeAt = typename std::tuple_element<pos, std::tuple<Real, T_ActiveTypes...>>::type;
+
+      /// View for a type of the helper.
+      template<typename Type>
+      using View = TypeDispatchView<Type, std::is_same<Type, Real>::value>;
+
+    private:
+
+      template<typename Type, typename... List>
+      struct IndexOfImpl {
+          static size_t constexpr value = 0;
+      };
+
+      template<typename Type, typename First, typename... Rest>
+      struct IndexOfImpl<Type, First, Rest...> {
+          static size_t constexpr value = std::is_same<Type, First>::value ? 0 : 1 + IndexOfImpl<Type, Rest...>::value;
+      };
+
+      template<typename Type>
+      struct IndexOf {
+          static size_t constexpr value = IndexOfImpl<Type, Real, T_ActiveTypes...>::value;
+          static_assert(value < TypeCount, "Type is not managed by the TypeDispatchHelper.");
+      };
+
+      using Identifiers = std::tuple<ActiveIdentifiers<T_ActiveTypes>...>;
+
+      std::vector<Real> values;
+      Identifiers identifiers;
+      size_t typeIndex;
+
+    public:
+
+      /// Constructor. Real is selected.
+      explicit TypeDispatchHelper(size_t size = 0) : values(), identifiers(), typeIndex(0) {
+        resize(size);
+      }
+
+      /// Destructor. Releases all identifiers.
+      ~TypeDispatchHelper() {
+        shrinkIdentifiers(std::integral_constant<size_t, 1>(), 0);
+      }
+
+      TypeDispatchHelper(TypeDispatchHelper const&) = delete;             ///< Identifiers are not copyable.
+      TypeDispatchHelper& operator=(TypeDispatchHelper const&) = delete;  ///< Identifiers are not copyable.
+
+      /*******************************************************************************/
+      /// @name Data management
+      /// @{
+
+      /// Change the number of entries. New entries are zero and passive.
+      void resize(size_t size) {
+        shrinkIdentifiers(std::integral_constant<size_t, 1>(), size);
+        values.resize(size, Real());
+        growIdentifiers(std::integral_constant<size_t, 1>(), size);
+      }
+
+      /// Number of entries.
+      size_t size() const {
+        return values.size();
+      }
+
+      /// Contiguous array of the primal values.
+      Real* primalData() {
+        return values.data();
+      }
+
+      /// Contiguous array of the primal values.
+      Real const* primalData() const {
+        return values.data();
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Type selection
+      /// @{
+
+      /// Select the type for dispatch(). The identifiers of the previously selected type are released.
+      void setTypeIndex(size_t newIndex) {
+        if (newIndex >= TypeCount) {
+          CODI_EXCEPTION("Type index %d is out of range.", (int)newIndex);
+        }
+
+        if (newIndex != typeIndex) {
+          releaseSelectedIdentifiers(std::integral_constant<size_t, 1>());
+          typeIndex = newIndex;
+        }
+      }
+
+      /// Select the type for dispatch(). The identifiers of the previously selected type are released.
+      template<typename Type>
+      void setType() {
+        setTypeIndex(IndexOf<Type>::value);
+      }
+
+      /// Index of the selected type. 0 is Real, i is the i-th active type.
+      size_t getTypeIndex() const {
+        return typeIndex;
+      }
+
+      /// True if Type is selected.
+      template<typename Type>
+      bool isType() const {
+        return IndexOf<Type>::value == typeIndex;
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Views and dispatch
+      /// @{
+
+      /// View of the data as values of type Type. Usually only the view of the selected type is used, see
+      /// setTypeIndex().
+      template<typename Type>
+      View<Type> view() {
+        return createView(std::integral_constant<size_t, IndexOf<Type>::value>());
+      }
+
+      /// Call func(view, args...) with the view of the selected type.
+      template<typename Func, typename... Args>
+      void dispatch(Func&& func, Args&&... args) {
+        dispatchRecursive(std::integral_constant<size_t, 0>(), func, std::forward<Args>(args)...);
+      }
+
+      /// @}
+
+    private:
+
+      View<Real> createView(std::integral_constant<size_t, 0>) {
+        return View<Real>(values.data(), values.size());
+      }
+
+      template<size_t pos>
+      View<TypeAt<pos>> createView(std::integral_constant<size_t, pos>) {
+        static_assert(std::is_same<Real, typename TypeAt<pos>::Real>::value,
+                      "The primal type of the active types has to be the primal type of the helper.");
+
+        return View<TypeAt<pos>>(values.data(), std::get<pos - 1>(identifiers).data(), values.size());
+      }
+
+      template<size_t pos, typename Func, typename... Args>
+      void dispatchRecursive(std::integral_constant<size_t, pos>, Func& func, Args&&... args) {
+        if (pos == typeIndex) {
+          func(createView(std::integral_constant<size_t, pos>()), std::forward<Args>(args)...);
+        } else {
+          dispatchRecursive(std::integral_constant<size_t, pos + 1>(), func, std::forward<Args>(args)...);
+        }
+      }
+
+      template<typename Func, typename... Args>
+      void dispatchRecursive(std::integral_constant<size_t, TypeCount>, Func& func, Args&&... args) {
+        CODI_UNUSED(func, args...);
+
+        CODI_EXCEPTION("Invalid type index %d.", (int)typeIndex);
+      }
+
+      /// Free the identifiers from size on of all active types. Called before the primal values are shrunk.
+      template<size_t pos>
+      void shrinkIdentifiers(std::integral_constant<size_t, pos>, size_t size) {
+        std::get<pos - 1>(identifiers).shrink(values.data(), size);
+
+        shrinkIdentifiers(std::integral_constant<size_t, pos + 1>(), size);
+      }
+
+      void shrinkIdentifiers(std::integral_constant<size_t, TypeCount>, size_t size) {
+        CODI_UNUSED(size);
+      }
+
+      /// Add passive identifiers up to size for all active types. Called after the primal values are grown.
+      template<size_t pos>
+      void growIdentifiers(std::integral_constant<size_t, pos>, size_t size) {
+        std::get<pos - 1>(identifiers).grow(values.data(), size);
+
+        growIdentifiers(std::integral_constant<size_t, pos + 1>(), size);
+      }
+
+      void growIdentifiers(std::integral_constant<size_t, TypeCount>, size_t size) {
+        CODI_UNUSED(size);
+      }
+
+      /// Release the identifiers of the selected type. Identifiers of all other types are already passive.
+      template<size_t pos>
+      void releaseSelectedIdentifiers(std::integral_constant<size_t, pos>) {
+        if (pos == typeIndex) {
+          std::get<pos - 1>(identifiers).release(values.data(), 0, values.size());
+        } else {
+          releaseSelectedIdentifiers(std::integral_constant<size_t, pos + 1>());
+        }
+      }
+
+      void releaseSelectedIdentifiers(std::integral_constant<size_t, TypeCount>) {}
+  };
+}
@@ -0,0 +1,799 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../../traits/computationTraits.hpp"
+#include "../../traits/realTraits.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Directed rounding helpers for Interval.
+   *
+   * The operations are computed in the default rounding mode. Error free transformations determine the direction of
+   * the rounding error of additions, multiplications, divisions and square roots, so that the result is only moved to
+   * the next floating point value if it is inexact. Other math functions are assumed to be accurate to one unit in the
+   * last place and are always widened by one floating point value.
+   *
+   * @tparam T_Real  Floating point type of the bounds.
+   */
+  template<typename T_Real>
+  struct IntervalRounding {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See IntervalRounding.
+
+      /// Next floating point value towards -infinity.
+      static CODI_INLINE Real down(Real const& v) {
+        return std::nextafter(v, -std::numeric_limits<Real>::infinity());
+      }
+
+      /// Next floating point value towards +infinity.
+      static CODI_INLINE Real up(Real const& v) {
+        return std::nextafter(v, std::numeric_limits<Real>::infinity());
+      }
+
+      /// Lower bound of a + b.
+      static CODI_INLINE Real addDown(Real const& a, Real const& b) {
+        Real s = a + b;
+        return (addError(a, b, s) < 0) ? down(s) : s;
+      }
+
+      /// Upper bound of a + b.
+      static CODI_INLINE Real addUp(Real const& a, Real const& b) {
+        Real s = a + b;
+        return (addError(a, b, s) > 0) ? up(s) : s;
+      }
+
+      /// Lower bound of a * b.
+      static CODI_INLINE Real mulDown(Real const& a, Real const& b) {
+        Real p = a * b;
+        return (std::fma(a, b, -p) < 0) ? down(p) : p;
+      }
+
+      /// Upper bound of a * b.
+      static CODI_INLINE Real mulUp(Real const& a, Real const& b) {
+        Real p = a * b;
+        return (std::fma(a, b, -p) > 0) ? up(p) : p;
+      }
+
+      /// Lower bound of a / b.
+      static CODI_INLINE Real divDown(Real const& a, Real const& b) {
+        Real q = a / b;
+        return (divError(a, b, q) < 0) ? down(q) : q;
+      }
+
+      /// Upper bound of a / b.
+      static CODI_INLINE Real divUp(Real const& a, Real const& b) {
+        Real q = a / b;
+        return (divError(a, b, q) > 0) ? up(q) : q;
+      }
+
+      /// Lower bound of sqrt(a).
+      static CODI_INLINE Real sqrtDown(Real const& a) {
+        Real s = std::sqrt(a);
+        return (std::fma(-s, s, a) < 0) ? down(s) : s;
+      }
+
+      /// Upper bound of sqrt(a).
+      static CODI_INLINE Real sqrtUp(Real const& a) {
+        Real s = std::sqrt(a);
+        return (std::fma(-s, s, a) > 0) ? up(s) : s;
+      }
+
+    private:
+
+      // Exact error of the rounded sum s = a + b (Knuth's TwoSum). NaN for non-finite values.
+      static CODI_INLINE Real addError(Real const& a, Real const& b, Real const& s) {
+        Real bv = s - a;
+        Real av = s - bv;
+        return (a - av) + (b - bv);
+      }
+
+      // Sign of the error of the rounded quotient q = a / b.
+      static CODI_INLINE Real divError(Real const& a, Real const& b, Real const& q) {
+        Real r = std::fma(-q, b, a);
+        return (b < 0) ? -r : r;
+      }
+  };
+
+  /**
+   * @brief Interval value with outward rounding.
+   *
+   * Can be used as the real type of CoDiPack active types, e.g. `RealReverseGen<Interval<double>>` or
+   * `RealForwardGen<Interval<double>>`. The primal values and the derivatives are then enclosures that contain the
+   * exact values for all points in the input intervals, including the round-off errors of the evaluation. See
+   * SignificanceAnalysis for a tool that uses interval adjoints to rank intermediate values.
+   *
+   * The bounds are rounded outwards after each operation, see IntervalRounding. An interval is also a passive real
+   * type, therefore active types are constructed from it directly, e.g. `Real x(Interval<double>(0.9, 1.1))`.
+   *
+   * Equality compares both bounds. The ordering operators compare the midpoints, such that branches in the program
+   * follow the midpoint value. Derivatives of non-smooth functions like abs, min and max are only enclosures if the
+   * kink is not contained in the argument interval.
+   *
+   * @tparam T_Real  Floating point type of the bounds.
+   */
+  template<typename T_Real>
+  struct Interval {
+    public:
+
+      using Real = CODI_DD(T_Real, double);  ///< See Interval.
+
+      using Rounding = IntervalRounding<Real>;  ///< Directed rounding helpers.
+
+    private:
+      Real lo;
+      Real hi;
+
+    public:
+
+      /// Constructor
+      CODI_INLINE Interval() : lo(), hi() {}
+
+      /// Constructor. Point interval.
+      CODI_INLINE Interval(Real const& v) : lo(v), hi(v) {}
+
+      /// Constructor. The bounds are swapped if lower > upper.
+      CODI_INLINE Interval(Real const& lower, Real const& upper)
+          : lo(std::min(lower, upper)), hi(std::max(lower, upper)) {}
+
+      /// Interval that contains v and the error of a computation in the precision of Other, e.g. float.
+      template<typename Other>
+      static CODI_INLINE Interval withRoundingOf(Real const& v) {
+        Real eps = (Real)std::numeric_limits<Other>::epsilon() * std::abs(v);
+        return Interval(Rounding::addDown(v, -eps), Rounding::addUp(v, eps));
+      }
+
+      /// Entire real line.
+      static CODI_INLINE Interval entire() {
+        return Interval(-std::numeric_limits<Real>::infinity(), std::numeric_limits<Real>::infinity());
+      }
+
+      /// Result of a function that is evaluated completely outside of its domain. Both bounds are NaN.
+      static CODI_INLINE Interval nan() {
+        return Interval(std::numeric_limits<Real>::quiet_NaN());
+      }
+
+      /*******************************************************************************/
+      /// @name Bounds and properties
+      /// @{
+
+      /// Lower bound.
+      CODI_INLINE Real const& lower() const {
+        return lo;
+      }
+
+      /// Upper bound.
+      CODI_INLINE Real const& upper() const {
+        return hi;
+      }
+
+      /// Midpoint.
+      CODI_INLINE Real mid() const {
+        if (lo == hi) {
+          return lo;
+        } else {
+          return 0.5 * lo + 0.5 * hi;
+        }
+      }
+
+      /// Width, rounded upwards.
+      CODI_INLINE Real width() const {
+        return Rounding::addUp(hi, -lo);
+      }
+
+      /// Largest absolute value.
+      CODI_INLINE Real mag() const {
+        return std::max(std::abs(lo), std::abs(hi));
+      }
+
+      /// Smallest absolute value.
+      CODI_INLINE Real mig() const {
+        if (lo <= 0 && 0 <= hi) {
+          return Real();
+        } else {
+          return std::min(std::abs(lo), std::abs(hi));
+        }
+      }
+
+      /// True if v is contained.
+      CODI_INLINE bool contains(Real const& v) const {
+        return lo <= v && v <= hi;
+      }
+
+      /// True if lower and upper bound are equal.
+      CODI_INLINE bool isPoint() const {
+        return lo == hi;
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Update operators
+      /// @{
+
+      /// Update operator.
+      CODI_INLINE Interval& operator+=(Interval const& v) {
+        lo = Rounding::addDown(lo, v.lo);
+        hi = Rounding::addUp(hi, v.hi);
+
+        return *this;
+      }
+
+      /// Update operator.
+      CODI_INLINE Interval& operator-=(Interval const& v) {
+        lo = Rounding::addDown(lo, -v.hi);
+        hi = Rounding::addUp(hi, -v.lo);
+
+        return *this;
+      }
+
+      /// Update operator.
+      CODI_INLINE Interval& operator*=(Interval const& v) {
+        Real const l = std::min(std::min(Rounding::mulDown(lo, v.lo), Rounding::mulDown(lo, v.hi)),
+                                std::min(Rounding::mulDown(hi, v.lo), Rounding::mulDown(hi, v.hi)));
+        Real const u = std::max(std::max(Rounding::mulUp(lo, v.lo), Rounding::mulUp(lo, v.hi)),
+                                std::max(Rounding::mulUp(hi, v.lo), Rounding::mulUp(hi, v.hi)));
+        lo = l;
+        hi = u;
+
+        return *this;
+      }
+
+      /// Update operator. Division by an interval that contains zero results in the entire real line.
+      CODI_INLINE Interval& operator/=(Interval const& v) {
+        if (v.contains(Real())) {
+          *this = entire();
+        } else {
+          Real const l = std::min(std::min(Rounding::divDown(lo, v.lo), Rounding::divDown(lo, v.hi)),
+                                  std::min(Rounding::divDown(hi, v.lo), Rounding::divDown(hi, v.hi)));
+          Real const u = std::max(std::max(Rounding::divUp(lo, v.lo), Rounding::divUp(lo, v.hi)),
+                                  std::max(Rounding::divUp(hi, v.lo), Rounding::divUp(hi, v.hi)));
+          lo = l;
+          hi = u;
+        }
+
+        return *this;
+      }
+
+      /// @}
+  };
+
+  /*******************************************************************************/
+  /// @name Interval arithmetic
+  /// @{
+
+#define CODI_INTERVAL_BINARY_OPERATOR(OP, UPDATE)                                                   \
+  /** Interval arithmetic. */                                                                      \
+  template<typename Real>                                                                          \
+  CODI_INLINE Interval<Real> OP(Interval<Real> const& a, Interval<Real> const& b) {                \
+    Interval<Real> r = a;                                                                          \
+    r UPDATE b;                                                                                    \
+    return r;                                                                                      \
+  }                                                                                                \
+                                                                                                   \
+  /** Interval arithmetic with a scalar. */                                                        \
+  template<typename Real>                                                                          \
+  CODI_INLINE Interval<Real> OP(Interval<Real> const& a, Real const& b) {                          \
+    return OP(a, Interval<Real>(b));                                                               \
+  }                                                                                                \
+                                                                                                   \
+  /** Interval arithmetic with a scalar. */                                                        \
+  template<typename Real>                                                                          \
+  CODI_INLINE Interval<Real> OP(Real const& a, Interval<Real> const& b) {                          \
+    return OP(Interval<Real>(a), b);                                                               \
+  }
+
+  CODI_INTERVAL_BINARY_OPERATOR(operator+, +=)
+  CODI_INTERVAL_BINARY_OPERATOR(operator-, -=)
+  CODI_INTERVAL_BINARY_OPERATOR(operator*, *=)
+  CODI_INTERVAL_BINARY_OPERATOR(operator/, /=)
+
+#undef CODI_INTERVAL_BINARY_OPERATOR
+
+  /// Negation.
+  template<typename Real>
+  CODI_INLINE Interval<Real> operator-(Interval<Real> const& a) {
+    return Interval<Real>(-a.upper(), -a.lower());
+  }
+
+  /// Identity.
+  template<typename Real>
+  CODI_INLINE Interval<Real> operator+(Interval<Real> const& a) {
+    return a;
+  }
+
+  /// @}
+  /*******************************************************************************/
+  /// @name Comparison
+  /// @{
+
+  /// Equality of both bounds.
+  template<typename Real>
+  CODI_INLINE bool operator==(Interval<Real> const& a, Interval<Real> const& b) {
+    return a.lower() == b.lower() && a.upper() == b.upper();
+  }
+
+  /// Equality of both bounds.
+  template<typename Real>
+  CODI_INLINE bool operator==(Interval<Real> const& a, Real const& b) {
+    return a.lower() == b && a.upper() == b;
+  }
+
+  /// Equality of both bounds.
+  template<typename Real>
+  CODI_INLINE bool operator==(Real const& a, Interval<Real> const& b) {
+    return b == a;
+  }
+
+  /// Inequality of at least one bound.
+  template<typename Real>
+  CODI_INLINE bool operator!=(Interval<Real> const& a, Interval<Real> const& b) {
+    return !(a == b);
+  }
+
+  /// Inequality of at least one bound.
+  template<typename Real>
+  CODI_INLINE bool operator!=(Interval<Real> const& a, Real const& b) {
+    return !(a == b);
+  }
+
+  /// Inequality of at least one bound.
+  template<typename Real>
+  CODI_INLINE bool operator!=(Real const& a, Interval<Real> const& b) {
+    return !(b == a);
+  }
+
+#define CODI_INTERVAL_ORDERING_OPERATOR(OP)                                      \
+  /** Comparison of the midpoints. */                                           \
+  template<typename Real>                                                       \
+  CODI_INLINE bool operator OP(Interval<Real> const& a, Interval<Real> const& b) { \
+    return a.mid() OP b.mid();                                                  \
+  }                                                                             \
+                                                                                \
+  /** Comparison of the midpoint. */                                            \
+  template<typename Real>                                                       \
+  CODI_INLINE bool operator OP(Interval<Real> const& a, Real const& b) {        \
+    return a.mid() OP b;                                                        \
+  }                                                                             \
+                                                                                \
+  /** Comparison of the midpoint. */                                            \
+  template<typename Real>                                                       \
+  CODI_INLINE bool operator OP(Real const& a, Interval<Real> const& b) {        \
+    return a OP b.mid();                                                        \
+  }
+
+  CODI_INTERVAL_ORDERING_OPERATOR(<)
+  CODI_INTERVAL_ORDERING_OPERATOR(<=)
+  CODI_INTERVAL_ORDERING_OPERATOR(>)
+  CODI_INTERVAL_ORDERING_OPERATOR(>=)
+
+#undef CODI_INTERVAL_ORDERING_OPERATOR
+
+  /// @}
+  /*******************************************************************************/
+  /// @name Math functions
+  /// @{
+
+  /// Value of pi used for the extrema and ranges of the trigonometric functions.
+  double constexpr IntervalPi = 3.14159265358979323846;
+
+  /// Absolute value.
+  template<typename Real>
+  CODI_INLINE Interval<Real> abs(Interval<Real> const& a) {
+    return Interval<Real>(a.mig(), a.mag());
+  }
+
+  /// Absolute value.
+  template<typename Real>
+  CODI_INLINE Interval<Real> fabs(Interval<Real> const& a) {
+    return abs(a);
+  }
+
+  /// Square root. Negative parts of the argument are ignored, entirely negative arguments result in NaN.
+  template<typename Real>
+  CODI_INLINE Interval<Real> sqrt(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    if (a.upper() < 0) {
+      return Interval<Real>::nan();
+    }
+    return Interval<Real>(Rounding::sqrtDown(std::max(a.lower(), Real())), Rounding::sqrtUp(a.upper()));
+  }
+
+  /// Exponential function.
+  template<typename Real>
+  CODI_INLINE Interval<Real> exp(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(std::max(Rounding::down(std::exp(a.lower())), Real()), Rounding::up(std::exp(a.upper())));
+  }
+
+  /// Logarithm with the function log. Arguments that contain zero have an infinite lower bound, entirely negative
+  /// arguments result in NaN.
+  template<typename Real, typename Func>
+  CODI_INLINE Interval<Real> intervalLogarithm(Interval<Real> const& a, Func&& log) {
+    using Rounding = IntervalRounding<Real>;
+    if (a.upper() < 0) {
+      return Interval<Real>::nan();
+    }
+    Real const lower = (a.lower() > 0) ? Rounding::down(log(a.lower())) : -std::numeric_limits<Real>::infinity();
+    return Interval<Real>(lower, Rounding::up(log(a.upper())));
+  }
+
+  /// Natural logarithm. See intervalLogarithm.
+  template<typename Real>
+  CODI_INLINE Interval<Real> log(Interval<Real> const& a) {
+    return intervalLogarithm(a, [](Real v) { return std::log(v); });
+  }
+
+  /// Logarithm to base 10. See intervalLogarithm.
+  template<typename Real>
+  CODI_INLINE Interval<Real> log10(Interval<Real> const& a) {
+    return intervalLogarithm(a, [](Real v) { return std::log10(v); });
+  }
+
+  /// Cubic root.
+  template<typename Real>
+  CODI_INLINE Interval<Real> cbrt(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(Rounding::down(std::cbrt(a.lower())), Rounding::up(std::cbrt(a.upper())));
+  }
+
+  /// Arc tangent.
+  template<typename Real>
+  CODI_INLINE Interval<Real> atan(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(Rounding::down(std::atan(a.lower())), Rounding::up(std::atan(a.upper())));
+  }
+
+  /// Arc sine. Parts of the argument outside of [-1, 1] are ignored, arguments outside of it result in NaN.
+  template<typename Real>
+  CODI_INLINE Interval<Real> asin(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    if (a.upper() < -1.0 || 1.0 < a.lower()) {
+      return Interval<Real>::nan();
+    }
+    return Interval<Real>(Rounding::down(std::asin(std::max(a.lower(), Real(-1.0)))),
+                          Rounding::up(std::asin(std::min(a.upper(), Real(1.0)))));
+  }
+
+  /// Arc cosine. Parts of the argument outside of [-1, 1] are ignored, arguments outside of it result in NaN.
+  template<typename Real>
+  CODI_INLINE Interval<Real> acos(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    if (a.upper() < -1.0 || 1.0 < a.lower()) {
+      return Interval<Real>::nan();
+    }
+    return Interval<Real>(std::max(Rounding::down(std::acos(std::min(a.upper(), Real(1.0)))), Real()),
+                          Rounding::up(std::acos(std::max(a.lower(), Real(-1.0)))));
+  }
+
+  /// Arc tangent of y / x in (-pi, pi]. The full range is returned if the arguments contain the origin or cross the
+  /// negative x axis. Otherwise, the extrema are attained at the corners of the argument box.
+  template<typename Real>
+  CODI_INLINE Interval<Real> atan2(Interval<Real> const& y, Interval<Real> const& x) {
+    using Rounding = IntervalRounding<Real>;
+    if (x.lower() <= 0 && y.contains(Real())) {
+      return Interval<Real>(Rounding::down(Real(-IntervalPi)), Rounding::up(Real(IntervalPi)));
+    }
+
+    Real const c1 = std::atan2(y.lower(), x.lower());
+    Real const c2 = std::atan2(y.lower(), x.upper());
+    Real const c3 = std::atan2(y.upper(), x.lower());
+    Real const c4 = std::atan2(y.upper(), x.upper());
+    return Interval<Real>(Rounding::down(std::min(std::min(c1, c2), std::min(c3, c4))),
+                          Rounding::up(std::max(std::max(c1, c2), std::max(c3, c4))));
+  }
+
+  /// Arc tangent of y / x.
+  template<typename Real>
+  CODI_INLINE Interval<Real> atan2(Interval<Real> const& y, Real const& x) {
+    return atan2(y, Interval<Real>(x));
+  }
+
+  /// Arc tangent of y / x.
+  template<typename Real>
+  CODI_INLINE Interval<Real> atan2(Real const& y, Interval<Real> const& x) {
+    return atan2(Interval<Real>(y), x);
+  }
+
+  /// Inverse hyperbolic tangent. Arguments that contain -1 or 1 have infinite bounds, arguments outside of (-1, 1)
+  /// result in NaN.
+  template<typename Real>
+  CODI_INLINE Interval<Real> atanh(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    if (a.upper() < -1.0 || 1.0 < a.lower()) {
+      return Interval<Real>::nan();
+    }
+    Real const inf = std::numeric_limits<Real>::infinity();
+    return Interval<Real>((a.lower() > -1.0) ? Rounding::down(std::atanh(a.lower())) : -inf,
+                          (a.upper() < 1.0) ? Rounding::up(std::atanh(a.upper())) : inf);
+  }
+
+  /// Hyperbolic sine.
+  template<typename Real>
+  CODI_INLINE Interval<Real> sinh(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(Rounding::down(std::sinh(a.lower())), Rounding::up(std::sinh(a.upper())));
+  }
+
+  /// Hyperbolic cosine.
+  template<typename Real>
+  CODI_INLINE Interval<Real> cosh(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(std::max(Rounding::down(std::cosh(a.mig())), Real(1.0)), Rounding::up(std::cosh(a.mag())));
+  }
+
+  /// Hyperbolic tangent.
+  template<typename Real>
+  CODI_INLINE Interval<Real> tanh(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(std::max(Rounding::down(std::tanh(a.lower())), Real(-1.0)),
+                          std::min(Rounding::up(std::tanh(a.upper())), Real(1.0)));
+  }
+
+
+  /**
+   * @brief Range of a 2 pi periodic function with values in [-1, 1].
+   *
+   * @param a          Argument interval.
+   * @param f          The function.
+   * @param maxOffset  Position of the maximum in [0, 2 pi).
+   * @param minOffset  Position of the minimum in [0, 2 pi).
+   */
+  template<typename Real, typename Func>
+  CODI_INLINE Interval<Real> intervalPeriodicRange(Interval<Real> const& a, Func&& f, Real maxOffset,
+                                                   Real minOffset) {
+    using Rounding = IntervalRounding<Real>;
+
+    Real const twoPi = 2.0 * IntervalPi;
+    if (!(a.width() < twoPi)) {
+      return Interval<Real>(-1.0, 1.0);
+    }
+
+    Real const fLo = f(a.lower());
+    Real const fHi = f(a.upper());
+    Real lo = std::max(Rounding::down(std::min(fLo, fHi)), Real(-1.0));
+    Real hi = std::min(Rounding::up(std::max(fLo, fHi)), Real(1.0));
+
+    // Extrema are included if they are close to the interval, the result stays an enclosure.
+    Real const slack = 8.0 * std::numeric_limits<Real>::epsilon() * (1.0 + a.mag());
+    auto containsExtremum = [&](Real offset) {
+      Real point = offset + twoPi * std::floor((a.lower() - offset) / twoPi);
+      for (int i = 0; i < 3; ++i) {
+        if (a.lower() - slack <= point && point <= a.upper() + slack) {
+          return true;
+        }
+        point += twoPi;
+      }
+      return false;
+    };
+
+    if (containsExtremum(maxOffset)) {
+      hi = 1.0;
+    }
+    if (containsExtremum(minOffset)) {
+      lo = -1.0;
+    }
+
+    return Interval<Real>(lo, hi);
+  }
+
+  /// Sine.
+  template<typename Real>
+  CODI_INLINE Interval<Real> sin(Interval<Real> const& a) {
+    return intervalPeriodicRange(a, [](Real v) { return std::sin(v); }, Real(0.5 * IntervalPi), Real(1.5 * IntervalPi));
+  }
+
+  /// Cosine.
+  template<typename Real>
+  CODI_INLINE Interval<Real> cos(Interval<Real> const& a) {
+    return intervalPeriodicRange(a, [](Real v) { return std::cos(v); }, Real(0.0), Real(IntervalPi));
+  }
+
+  /// Tangent. Arguments that contain a pole result in the entire real line.
+  template<typename Real>
+  CODI_INLINE Interval<Real> tan(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+
+    // Poles are assumed if they are close to the interval, the result stays an enclosure.
+    Real const slack = 8.0 * std::numeric_limits<Real>::epsilon() * (1.0 + a.mag());
+    Real const pole = 0.5 * IntervalPi + IntervalPi * std::floor((a.lower() - 0.5 * IntervalPi) / IntervalPi);
+    if (!(a.width() < IntervalPi) || a.lower() - slack <= pole || pole + IntervalPi <= a.upper() + slack) {
+      return Interval<Real>::entire();
+    }
+
+    return Interval<Real>(Rounding::down(std::tan(a.lower())), Rounding::up(std::tan(a.upper())));
+  }
+
+  /// Error function.
+  template<typename Real>
+  CODI_INLINE Interval<Real> erf(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(std::max(Rounding::down(std::erf(a.lower())), Real(-1.0)),
+                          std::min(Rounding::up(std::erf(a.upper())), Real(1.0)));
+  }
+
+  /// Complementary error function.
+  template<typename Real>
+  CODI_INLINE Interval<Real> erfc(Interval<Real> const& a) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(std::max(Rounding::down(std::erfc(a.upper())), Real()),
+                          std::min(Rounding::up(std::erfc(a.lower())), Real(2.0)));
+  }
+
+  /// Euclidean norm of a and b.
+  template<typename Real>
+  CODI_INLINE Interval<Real> hypot(Interval<Real> const& a, Interval<Real> const& b) {
+    using Rounding = IntervalRounding<Real>;
+    return Interval<Real>(Rounding::down(std::hypot(a.mig(), b.mig())), Rounding::up(std::hypot(a.mag(), b.mag())));
+  }
+
+  /// Integer power by repeated multiplication.
+  template<typename Real>
+  CODI_INLINE Interval<Real> intervalIntegerPow(Interval<Real> const& a, long n) {
+    if (n < 0) {
+      return Interval<Real>(1.0) / intervalIntegerPow(a, -n);
+    }
+
+    // Even powers are computed from the absolute value, odd powers are monotonic.
+    Interval<Real> lowerBase = (0 == n % 2) ? abs(a) : Interval<Real>(a.lower());
+    Interval<Real> upperBase = (0 == n % 2) ? abs(a) : Interval<Real>(a.upper());
+    Interval<Real> lower = 1.0;
+    Interval<Real> upper = 1.0;
+    while (n > 0) {
+      if (0 != (n & 1)) {
+        lower *= lowerBase;
+        upper *= upperBase;
+      }
+      lowerBase *= lowerBase;
+      upperBase *= upperBase;
+      n >>= 1;
+    }
+
+    return Interval<Real>(lower.lower(), upper.upper());
+  }
+
+  /// Power function. Integer point exponents allow negative bases, otherwise exp(b * log(a)) is evaluated.
+  template<typename Real>
+  CODI_INLINE Interval<Real> pow(Interval<Real> const& a, Interval<Real> const& b) {
+    if (b.isPoint() && b.lower() == std::floor(b.lower()) && std::abs(b.lower()) < 1e9) {
+      return intervalIntegerPow(a, (long)b.lower());
+    } else {
+      return exp(b * log(a));
+    }
+  }
+
+  /// Power function.
+  template<typename Real>
+  CODI_INLINE Interval<Real> pow(Interval<Real> const& a, Real const& b) {
+    return pow(a, Interval<Real>(b));
+  }
+
+  /// Power function.
+  template<typename Real>
+  CODI_INLINE Interval<Real> pow(Real const& a, Interval<Real> const& b) {
+    return pow(Interval<Real>(a), b);
+  }
+
+  /// Splits the bounds into integral and fractional parts. The integral part is stored in integral.
+  template<typename Real>
+  CODI_INLINE Interval<Real> modf(Interval<Real> const& a, Interval<Real>* integral) {
+    *integral = Interval<Real>(std::trunc(a.lower()), std::trunc(a.upper()));
+    return a - *integral;
+  }
+
+  /// Component wise minimum.
+  template<typename Real>
+  CODI_INLINE Interval<Real> min(Interval<Real> const& a, Interval<Real> const& b) {
+    return Interval<Real>(std::min(a.lower(), b.lower()), std::min(a.upper(), b.upper()));
+  }
+
+  /// Component wise maximum.
+  template<typename Real>
+  CODI_INLINE Interval<Real> max(Interval<Real> const& a, Interval<Real> const& b) {
+    return Interval<Real>(std::max(a.lower(), b.lower()), std::max(a.upper(), b.upper()));
+  }
+
+  /// Component wise minimum.
+  template<typename Real>
+  CODI_INLINE Interval<Real> fmin(Interval<Real> const& a, Interval<Real> const& b) {
+    return min(a, b);
+  }
+
+  /// Component wise maximum.
+  template<typename Real>
+  CODI_INLINE Interval<Real> fmax(Interval<Real> const& a, Interval<Real> const& b) {
+    return max(a, b);
+  }
+
+  /// True if both bounds are finite.
+  template<typename Real>
+  CODI_INLINE bool isfinite(Interval<Real> const& a) {
+    return std::isfinite(a.lower()) && std::isfinite(a.upper());
+  }
+
+  /// True if one bound is infinite.
+  template<typename Real>
+  CODI_INLINE bool isinf(Interval<Real> const& a) {
+    return std::isinf(a.lower()) || std::isinf(a.upper());
+  }
+
+  /// True if one bound is not a number.
+  template<typename Real>
+  CODI_INLINE bool isnan(Interval<Real> const& a) {
+    return std::isnan(a.lower()) || std::isnan(a.upper());
+  }
+
+  /// Output stream operator.
+  template<typename Real>
+  std::ostream& operator<<(std::ostream& out, Interval<Real> const& a) {
+    out << "[" << a.lower() << ", " << a.upper() << "]";
+    return out;
+  }
+
+  /// @}
+
+#ifndef DOXYGEN_DISABLE
+  template<typename T_Real>
+  struct RealTraits::IsTotalFinite<Interval<T_Real>> {
+    public:
+
+      using Type = Interval<T_Real>;
+
+      static CODI_INLINE bool isTotalFinite(Type const& v) {
+        return isfinite(v);
+      }
+  };
+
+  template<typename T_Real>
+  struct ComputationTraits::TransposeImpl<Interval<T_Real>> {
+    public:
+      using Jacobian = Interval<T_Real>;
+      using Return = Interval<T_Real>;
+
+      static Return transpose(Jacobian const& jacobian) {
+        return jacobian;
+      }
+  };
+#endif
+}
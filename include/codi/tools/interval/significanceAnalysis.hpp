@@ -0,0 +1,301 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/eventSystem.hpp"
+#include "../../misc/macros.hpp"
+#include "../../traits/gradientTraits.hpp"
+#include "interval.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Ranks the recorded statements of an interval tape by their significance.
+   *
+   * The significance of an intermediate value v is the product of its width and the magnitude of its interval
+   * adjoint, \f$ w([v]) \cdot |[\bar v]| \f$. It estimates how much the uncertainty in v, e.g. the round-off error of a
+   * lower precision computation, can change the outputs. Statements with a small significance can be computed in a
+   * lower precision. Interval::withRoundingOf can be used to widen inputs by the rounding error of e.g. float.
+   *
+   * The analysis listens to the statement events of the tape, therefore CoDiPack has to be compiled with
+   * CODI_StatementEvents. Each statement that is stored on the tape creates an entry. The interval adjoints are
+   * collected during a full reverse evaluation of the tape, i.e. tape.evaluate(). Entries can be named with setName
+   * directly after the value has been computed.
+   *
+   * \code{.cpp}
+   *   using Real = codi::RealReverseGen<codi::Interval<double>>;
+   *   codi::SignificanceAnalysis<Real> analysis;
+   *
+   *   // Record with intervals as inputs.
+   *   Real t = sin(x);
+   *   analysis.setName(t, "t");
+   *   // ...
+   *
+   *   y.setGradient(1.0);
+   *   tape.evaluate();
+   *   analysis.printReport(std::cout, 10);
+   * \endcode
+   *
+   * The entries are cleared on a full tape reset. A reset to a position removes the entries that were recorded after
+   * the position.
+   *
+   * @tparam T_Type  Active CoDiPack type with an Interval as real type.
+   */
+  template<typename T_Type>
+  struct SignificanceAnalysis {
+    public:
+
+      using Type = CODI_DD(T_Type, CODI_T(ActiveType<CODI_DEFAULT_TAPE>));  ///< See SignificanceAnalysis.
+
+      using Tape = typename Type::Tape;              ///< Tape of the active type.
+      using Real = typename Type::Real;              ///< Interval type of the tape.
+      using Identifier = typename Type::Identifier;  ///< Identifier of the tape.
+      using Position = typename Tape::Position;      ///< Position of the tape.
+      using Bound = typename Real::Real;             ///< Floating point type of the interval bounds.
+
+      using Events = EventSystem<Tape>;                      ///< Event system of the tape.
+      using Handle = typename Events::Handle;                ///< Listener handle.
+      using VectorAccess = typename Events::VectorAccess;    ///< Vector access of the event system.
+      using GradientValue = typename Events::GradientValue;  ///< Interval type of the adjoint components.
+
+      CODI_STATIC_ASSERT(Config::StatementEvents || std::is_void<T_Type>::value,
+                         "The significance analysis requires CODI_StatementEvents.");
+
+      /// Data of one recorded statement.
+      struct Entry {
+        public:
+          size_t statement;       ///< Position of the statement in the recording order.
+          Identifier identifier;  ///< Identifier of the left hand side.
+          Real value;             ///< Interval value of the left hand side.
+          Bound adjointMag;       ///< Magnitude of the interval adjoint.
+          std::string name;       ///< Name set with setName, otherwise empty.
+          Position position;      ///< Tape position after the statement.
+
+          /// Width times adjoint magnitude.
+          Bound significance() const {
+            if (Bound() == adjointMag) {
+              return Bound();  // Also for infinite widths.
+            } else {
+              return value.width() * adjointMag;
+            }
+          }
+      };
+
+    private:
+
+      std::vector<Entry> entries;
+      std::vector<Handle> handles;
+
+      bool reverseEvaluation;
+      size_t evaluatePos;
+
+    public:
+
+      /// Constructor. Registers the listeners in the event system of the tape.
+      SignificanceAnalysis() : entries(), handles(), reverseEvaluation(false), evaluatePos(0) {
+        handles.push_back(Events::registerStatementStoreOnTapeListener(storeCallback, this));
+        handles.push_back(Events::registerStatementEvaluateListener(evaluateCallback, this));
+        handles.push_back(Events::registerTapeEvaluateListener(tapeEvaluateCallback, this));
+        handles.push_back(Events::registerTapeResetListener(resetCallback, this));
+      }
+
+      /// Destructor. Removes the listeners.
+      ~SignificanceAnalysis() {
+        for (Handle const& handle : handles) {
+          Events::deregisterListener(handle);
+        }
+      }
+
+      SignificanceAnalysis(SignificanceAnalysis const&) = delete;             ///< Listeners refer to this object.
+      SignificanceAnalysis& operator=(SignificanceAnalysis const&) = delete;  ///< Listeners refer to this object.
+
+      /// Name the statement that computed the current value of v. Returns false if v is not active.
+      bool setName(Type const& v, std::string const& name) {
+        for (size_t i = entries.size(); i > 0; i -= 1) {
+          if (v.getIdentifier() == entries[i - 1].identifier) {
+            entries[i - 1].name = name;
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      /// All entries in recording order.
+      std::vector<Entry> const& getEntries() const {
+        return entries;
+      }
+
+      /// Entry indices sorted by decreasing significance.
+      std::vector<size_t> getRanking() const {
+        std::vector<size_t> ranking(entries.size());
+        for (size_t i = 0; i < ranking.size(); ++i) {
+          ranking[i] = i;
+        }
+
+        std::stable_sort(ranking.begin(), ranking.end(), [this](size_t a, size_t b) {
+          return entries[a].significance() > entries[b].significance();
+        });
+
+        return ranking;
+      }
+
+      /// Entry indices with a significance that is at most threshold, in recording order.
+      std::vector<size_t> getInsignificant(Bound const& threshold) const {
+        std::vector<size_t> result;
+        for (size_t i = 0; i < entries.size(); ++i) {
+          if (entries[i].significance() <= threshold) {
+            result.push_back(i);
+          }
+        }
+
+        return result;
+      }
+
+      /// Remove all entries.
+      void clear() {
+        entries.clear();
+        reverseEvaluation = false;
+        evaluatePos = 0;
+      }
+
+      /// Print the most significant entries. All entries are printed if maxEntries is zero.
+      template<typename Stream = std::ostream>
+      void printReport(Stream& out, size_t maxEntries = 0) const {
+        std::vector<size_t> ranking = getRanking();
+        if (0 == maxEntries || maxEntries > ranking.size()) {
+          maxEntries = ranking.size();
+        }
+
+        std::ios_base::fmtflags flags = out.flags();
+        std::streamsize precision = out.precision();
+
+        out << "-------------------------------------" << std::endl
+            << "CoDi Significance Analysis" << std::endl
+            << "-------------------------------------" << std::endl;
+        out << "Statements: " << entries.size() << std::endl;
+        out << std::setw(10) << "Statement" << " " << std::setw(12) << "Name" << " " << std::setw(12) << "Width"
+            << " " << std::setw(12) << "|Adjoint|" << " " << std::setw(12) << "Significance" << std::endl;
+        out << std::scientific << std::setprecision(4);
+        for (size_t i = 0; i < maxEntries; ++i) {
+          Entry const& entry = entries[ranking[i]];
+          out << std::setw(10) << entry.statement << " " << std::setw(12) << entry.name << " " << std::setw(12)
+              << entry.value.width() << " " << std::setw(12) << entry.adjointMag << " " << std::setw(12)
+              << entry.significance() << std::endl;
+        }
+        out << "-------------------------------------" << std::endl;
+
+        out.flags(flags);
+        out.precision(precision);
+      }
+
+    private:
+
+      static void storeCallback(Tape& tape, Identifier const& lhsIdentifier, Real const& newValue,
+                                size_t numActiveVariables, Identifier const* rhsIdentifiers, Real const* jacobians,
+                                void* customData) {
+        CODI_UNUSED(numActiveVariables, rhsIdentifiers, jacobians);
+
+        SignificanceAnalysis& analysis = *static_cast<SignificanceAnalysis*>(customData);
+        analysis.entries.push_back(
+            Entry{analysis.entries.size(), lhsIdentifier, newValue, Bound(), std::string(), tape.getPosition()});
+      }
+
+      static void evaluateCallback(Tape& tape, Identifier const& lhsIdentifier, size_t sizeLhsAdjoint,
+                                   GradientValue const* lhsAdjoint, void* customData) {
+        CODI_UNUSED(tape);
+
+        SignificanceAnalysis& analysis = *static_cast<SignificanceAnalysis*>(customData);
+        if (!analysis.reverseEvaluation || 0 == analysis.evaluatePos) {
+          return;
+        }
+
+        analysis.evaluatePos -= 1;
+        Entry& entry = analysis.entries[analysis.evaluatePos];
+        codiAssert(entry.identifier == lhsIdentifier);
+        CODI_UNUSED(lhsIdentifier);
+
+        Bound mag = Bound();
+        for (size_t i = 0; i < sizeLhsAdjoint; ++i) {
+          mag = std::max(mag, lhsAdjoint[i].mag());
+        }
+        entry.adjointMag = mag;
+      }
+
+      static void tapeEvaluateCallback(Tape& tape, Position const& start, Position const& end, VectorAccess* adjoint,
+                                       EventHints::EvaluationKind evalKind, EventHints::Endpoint endpoint,
+                                       void* customData) {
+        CODI_UNUSED(adjoint);
+
+        SignificanceAnalysis& analysis = *static_cast<SignificanceAnalysis*>(customData);
+        if (EventHints::EvaluationKind::Reverse != evalKind) {
+          return;
+        }
+
+        if (EventHints::Endpoint::Begin == endpoint) {
+          // Only full evaluations can be mapped to the recorded statements.
+          analysis.reverseEvaluation = (start == tape.getPosition() && end == tape.getZeroPosition());
+          analysis.evaluatePos = analysis.entries.size();
+        } else {
+          analysis.reverseEvaluation = false;
+        }
+      }
+
+      static void resetCallback(Tape& tape, Position const& position, EventHints::Reset kind, bool clearAdjoints,
+                                void* customData) {
+        CODI_UNUSED(tape, clearAdjoints);
+
+        SignificanceAnalysis& analysis = *static_cast<SignificanceAnalysis*>(customData);
+        if (EventHints::Reset::To == kind) {
+          while (!analysis.entries.empty() && position < analysis.entries.back().position) {
+            analysis.entries.pop_back();
+          }
+          analysis.reverseEvaluation = false;
+          analysis.evaluatePos = 0;
+        } else {
+          analysis.clear();
+        }
+      }
+  };
+}
@@ -0,0 +1,435 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "../../tapes/misc/tapeParameters.hpp"
+#include "../../traits/atomicTraits.hpp"
+#include "../../traits/realTraits.hpp"
+#include "atomicInterface.hpp"
+#include "parallelToolbox.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Atomic adjoint type that accumulates updates of hot identifiers in thread-local buffers.
+   *
+   * In parallel reverse sweeps with ThreadSafeGlobalAdjoints, adjoints that receive updates from all threads, e.g.,
+   * the adjoints of design variables, serialize the threads on atomic updates. This type can be used as the gradient
+   * type of a parallel tape instead of ParallelToolbox::Atomic<Type>. Each adjoint variable may be marked as hot. Updates
+   * of hot adjoint variables are accumulated without atomics into a private buffer of the updating thread. The buffers
+   * are reduced into the adjoint variables at synchronization points by reduceThreadBuffer() or reduceAllBuffers(). All
+   * other adjoint variables are updated atomically as usual.
+   *
+   * Hot identifiers can be chosen manually with markHot(), or automatically. For the latter, a first reverse sweep is
+   * performed between beginAccessCounting() and endAccessCounting(), and selectHotIdentifiers() marks the adjoint
+   * variables with the most updates. Adjoint variables that are read or overwritten during the counting sweep, i.e.,
+   * the adjoints of left hand sides, are never selected. Only pure accumulators like the adjoints of inputs remain.
+   *
+   * Reading a hot adjoint variable includes the contributions in the buffers of all threads, and overwriting it, e.g.,
+   * with zero, discards them. Both access the buffers of other threads, so hot adjoint variables must not be read or
+   * overwritten during a parallel sweep. This is why left hand side identifiers must not be marked manually.
+   *
+   * The hot marks and access counts are kept per identifier outside of the adjoint variables, such that this type has
+   * the size of the underlying atomic. An adjoint variable finds its identifier by its position in the adjoint vector
+   * of the tape. The position of the adjoint vector is captured by all configuration functions and by
+   * reduceAllBuffers(). If the adjoint vector is reallocated in between, hot updates are performed atomically until it
+   * is captured again. Resize the adjoint vector to its final size before hot identifiers are selected.
+   *
+   * The configuration is global for each instantiation of this type, just like the adjoint vector in
+   * ThreadSafeGlobalAdjoints. All configuration functions must be called outside of parallel regions.
+   *
+   * @tparam T_Type             The underlying arithmetic type.
+   * @tparam T_ParallelToolbox  The parallel toolbox of the tape. See codi::ParallelToolbox.
+   */
+  template<typename T_Type, typename T_ParallelToolbox>
+  struct BufferedAtomic : public AtomicInterface<T_Type, BufferedAtomic<T_Type, T_ParallelToolbox>> {
+    public:
+      using Type = CODI_DD(T_Type, double);  ///< See BufferedAtomic.
+      /// See BufferedAtomic.
+      using ParallelToolbox = CODI_DD(T_ParallelToolbox, CODI_DEFAULT_PARALLEL_TOOLBOX);
+
+      using Base = AtomicInterface<Type, BufferedAtomic>;                       ///< Base class abbreviation.
+      using ThreadInformation = typename ParallelToolbox::ThreadInformation;  ///< See ParallelToolbox.
+      using Atomic = typename ParallelToolbox::template Atomic<Type>;          ///< See ParallelToolbox.
+      using AtomicInt = typename ParallelToolbox::template Atomic<int>;        ///< See ParallelToolbox.
+
+      CODI_STATIC_ASSERT(std::is_arithmetic<Type>::value, "BufferedAtomic supports only arithmetic types.");
+
+    private:
+
+      /// Access count of adjoint variables that have been read or overwritten. Stays negative under increments.
+      static int constexpr Excluded = std::numeric_limits<int>::min() / 2;
+
+      Atomic value;
+
+      static bool tracking;  ///< True if hot identifiers are marked or accesses are counted.
+      static bool countAccesses;
+      static BufferedAtomic const* adjointsBase;  ///< Captured position of the adjoint vector.
+      static size_t adjointsSize;                 ///< Captured size of the adjoint vector.
+      static std::vector<AtomicInt> accessCounts;  ///< Per identifier.
+      static std::vector<int> hotSlots;            ///< Per identifier, index in the buffers or -1. Empty if none is hot.
+      static std::vector<size_t> hotIdentifiers;
+      static std::vector<std::vector<Type>> threadBuffers;
+
+    public:
+
+      CODI_INLINE BufferedAtomic() : Base(), value() {}
+
+      /// Copies the value including the buffered contributions.
+      CODI_INLINE BufferedAtomic(BufferedAtomic const& other) : Base(), value((Type)other) {}
+
+      CODI_INLINE BufferedAtomic(Type const& other) : Base(), value(other) {}
+
+      CODI_INLINE BufferedAtomic& operator=(BufferedAtomic const& other) {
+        return operator=((Type)other);
+      }
+
+      /// For hot variables, the buffered contributions are discarded.
+      CODI_INLINE BufferedAtomic& operator=(Type const& other) {
+        if (tracking) {
+          size_t const identifier = getIdentifier();
+          if (identifier < adjointsSize) {
+            if (countAccesses) {
+              accessCounts[identifier] = int(Excluded);
+            }
+            int const slot = getSlot(identifier);
+            if (0 <= slot) {
+              for (std::vector<Type>& buffer : threadBuffers) {
+                buffer[slot] = Type();
+              }
+            }
+          }
+        }
+
+        value = other;
+        return *this;
+      }
+
+      CODI_INLINE Type operator+=(BufferedAtomic const& other) {
+        return operator+=((Type)other);
+      }
+
+      /// Accumulates into the buffer of the calling thread if this adjoint variable is hot, atomically otherwise. For
+      /// hot variables, the value in the buffer is returned.
+      CODI_INLINE Type operator+=(Type const& other) {
+        if (tracking) {
+          size_t const identifier = getIdentifier();
+          if (identifier < adjointsSize) {
+            if (countAccesses) {
+              ++accessCounts[identifier];
+            }
+
+            int const slot = getSlot(identifier);
+            if (0 <= slot) {
+              Type& buffered = threadBuffers[ThreadInformation::getThreadId()][slot];
+              buffered += other;
+              return buffered;
+            }
+          }
+        }
+
+        return value += other;
+      }
+
+      /// Value including the contributions that are still in thread-local buffers.
+      CODI_INLINE operator Type() const {
+        Type result = value;
+
+        if (tracking) {
+          size_t const identifier = getIdentifier();
+          if (identifier < adjointsSize) {
+            if (countAccesses) {
+              accessCounts[identifier] = int(Excluded);
+            }
+            int const slot = getSlot(identifier);
+            if (0 <= slot) {
+              for (std::vector<Type> const& buffer : threadBuffers) {
+                result += buffer[slot];
+              }
+            }
+          }
+        }
+
+        return result;
+      }
+
+      /*******************************************************************************/
+      /// @name Configuration of hot identifiers. Call outside of parallel regions.
+      /// @{
+
+      /// Start to count the updates of each adjoint variable. Resizes the adjoint vector.
+      template<typename Tape>
+      static void beginAccessCounting(Tape& tape) {
+        captureAdjointVector(tape);
+
+        accessCounts = std::vector<AtomicInt>(adjointsSize, AtomicInt(0));
+        countAccesses = true;
+        updateTracking();
+      }
+
+      /// Stop to count the updates of each adjoint variable.
+      static void endAccessCounting() {
+        countAccesses = false;
+        updateTracking();
+      }
+
+      /**
+       * @brief Mark the adjoint variables with the most counted updates as hot. Resets the counts.
+       *
+       * Previous marks are reduced and removed. Adjoint variables that have been read or overwritten during the counting
+       * sweep are not considered.
+       *
+       * @param tape               The tape that performed the counting sweep.
+       * @param threshold          Minimum number of updates.
+       * @param maxHotIdentifiers  Upper bound for the number of hot identifiers, the ones with more updates are kept.
+       *
+       * @return Number of hot identifiers.
+       */
+      template<typename Tape>
+      static size_t selectHotIdentifiers(Tape& tape, int threshold,
+                                         size_t maxHotIdentifiers = std::numeric_limits<size_t>::max()) {
+        clearHotIdentifiers(tape);
+
+        threshold = std::max(threshold, 1);
+
+        std::vector<std::pair<int, size_t>> candidates;
+        for (size_t identifier = 1; identifier < accessCounts.size(); identifier += 1) {
+          int const count = accessCounts[identifier];
+          if (threshold <= count) {
+            candidates.push_back(std::make_pair(count, identifier));
+          }
+        }
+        accessCounts.clear();
+
+        if (maxHotIdentifiers < candidates.size()) {
+          std::partial_sort(candidates.begin(), candidates.begin() + maxHotIdentifiers, candidates.end(),
+                            [](std::pair<int, size_t> const& a, std::pair<int, size_t> const& b) {
+                              return a.first > b.first;
+                            });
+          candidates.resize(maxHotIdentifiers);
+        }
+
+        for (std::pair<int, size_t> const& candidate : candidates) {
+          addHot(candidate.second);
+        }
+        resizeBuffers();
+        updateTracking();
+
+        return hotIdentifiers.size();
+      }
+
+      /// Mark the adjoint variable of the identifier as hot. It must not be the left hand side of any statement.
+      template<typename Tape>
+      static void markHot(Tape& tape, typename Tape::Identifier const& identifier) {
+        captureAdjointVector(tape);
+
+        codiAssert((size_t)identifier < adjointsSize);
+        addHot((size_t)identifier);
+        resizeBuffers();
+        updateTracking();
+      }
+
+      /// Reduce all buffers and remove all hot marks.
+      template<typename Tape>
+      static void clearHotIdentifiers(Tape& tape) {
+        reduceAllBuffers(tape);
+
+        hotSlots.clear();
+        hotIdentifiers.clear();
+        resizeBuffers();
+        updateTracking();
+      }
+
+      /// Number of hot identifiers.
+      static size_t getNumberOfHotIdentifiers() {
+        return hotIdentifiers.size();
+      }
+
+      /// @}
+      /*******************************************************************************/
+      /// @name Reduction of the thread-local buffers.
+      /// @{
+
+      /**
+       * @brief Add the buffer of the calling thread to the adjoint variables and zero it.
+       *
+       * Can be called by all threads simultaneously, e.g., at the end of each thread's reverse sweep.
+       */
+      template<typename Tape>
+      static void reduceThreadBuffer(Tape& tape) {
+        reduceBuffer(tape, ThreadInformation::getThreadId());
+      }
+
+      /**
+       * @brief Add the buffers of all threads to the adjoint variables and zero them. Must be called by a single thread.
+       *
+       * Also captures the position of the adjoint vector again.
+       */
+      template<typename Tape>
+      static void reduceAllBuffers(Tape& tape) {
+        for (int threadId = 0; threadId < (int)threadBuffers.size(); threadId += 1) {
+          reduceBuffer(tape, threadId);
+        }
+
+        if (tracking) {
+          captureAdjointVector(tape);
+        }
+      }
+
+      /// @}
+
+    private:
+
+      /// Identifier of this adjoint variable, or a value of at least adjointsSize if it is not in the adjoint vector.
+      CODI_INLINE size_t getIdentifier() const {
+        return (size_t)(((uintptr_t)this - (uintptr_t)adjointsBase) / sizeof(BufferedAtomic));
+      }
+
+      static CODI_INLINE int getSlot(size_t identifier) {
+        return hotSlots.empty() ? -1 : hotSlots[identifier];
+      }
+
+      static void updateTracking() {
+        tracking = countAccesses || !hotIdentifiers.empty();
+      }
+
+      template<typename Tape>
+      static void captureAdjointVector(Tape& tape) {
+        tape.resizeAdjointVector();
+
+        tape.beginUseAdjointVector();
+        adjointsBase = &tape.gradient(0, AdjointsManagement::Manual);
+        adjointsSize = tape.getParameter(TapeParameters::AdjointSize);
+        tape.endUseAdjointVector();
+
+        if (!hotSlots.empty()) {
+          hotSlots.resize(adjointsSize, -1);
+        }
+      }
+
+      static void addHot(size_t identifier) {
+        if (hotSlots.empty()) {
+          hotSlots.resize(adjointsSize, -1);
+        }
+
+        if (0 > hotSlots[identifier]) {
+          hotSlots[identifier] = (int)hotIdentifiers.size();
+          hotIdentifiers.push_back(identifier);
+        }
+      }
+
+      template<typename Tape>
+      static void reduceBuffer(Tape& tape, int threadId) {
+        if (hotIdentifiers.empty()) {
+          return;
+        }
+
+        std::vector<Type>& buffer = threadBuffers[threadId];
+
+        tape.beginUseAdjointVector();
+        for (size_t hot = 0; hot < hotIdentifiers.size(); hot += 1) {
+          if (Type() != buffer[hot]) {
+            tape.gradient(hotIdentifiers[hot], AdjointsManagement::Manual).value += buffer[hot];
+            buffer[hot] = Type();
+          }
+        }
+        tape.endUseAdjointVector();
+      }
+
+      static void resizeBuffers() {
+        // Round up to full cache lines such that buffers of different threads do not share a cache line.
+        size_t constexpr PerLine = Config::CacheLineSize / sizeof(Type) > 0 ? Config::CacheLineSize / sizeof(Type) : 1;
+        size_t const bufferSize = (hotIdentifiers.size() + PerLine - 1) / PerLine * PerLine;
+
+        threadBuffers.resize(ThreadInformation::getMaxThreads());
+        for (std::vector<Type>& buffer : threadBuffers) {
+          buffer.resize(bufferSize, Type());
+        }
+      }
+  };
+
+  template<typename Type, typename ParallelToolbox>
+  bool BufferedAtomic<Type, ParallelToolbox>::tracking = false;
+
+  template<typename Type, typename ParallelToolbox>
+  bool BufferedAtomic<Type, ParallelToolbox>::countAccesses = false;
+
+  template<typename Type, typename ParallelToolbox>
+  BufferedAtomic<Type, ParallelToolbox> const* BufferedAtomic<Type, ParallelToolbox>::adjointsBase = nullptr;
+
+  template<typename Type, typename ParallelToolbox>
+  size_t BufferedAtomic<Type, ParallelToolbox>::adjointsSize = 0;
+
+  template<typename Type, typename ParallelToolbox>
+  std::vector<typename BufferedAtomic<Type, ParallelToolbox>::AtomicInt>
+      BufferedAtomic<Type, ParallelToolbox>::accessCounts;
+
+  template<typename Type, typename ParallelToolbox>
+  std::vector<int> BufferedAtomic<Type, ParallelToolbox>::hotSlots;
+
+  template<typename Type, typename ParallelToolbox>
+  std::vector<size_t> BufferedAtomic<Type, ParallelToolbox>::hotIdentifiers;
+
+  template<typename Type, typename ParallelToolbox>
+  std::vector<std::vector<Type>> BufferedAtomic<Type, ParallelToolbox>::threadBuffers;
+
+  /// Declare BufferedAtomic to be atomic in terms of AtomicTraits.
+  template<typename T_Type, typename T_ParallelToolbox>
+  struct AtomicTraits::IsAtomic<BufferedAtomic<T_Type, T_ParallelToolbox>> : std::true_type {};
+
+#ifndef DOXYGEN_DISABLE
+  // Specialize IsTotalZero for BufferedAtomic.
+  template<typename T_Type, typename T_ParallelToolbox>
+  struct RealTraits::IsTotalZero<BufferedAtomic<T_Type, T_ParallelToolbox>> {
+    public:
+
+      using Type = CODI_DD(CODI_T(BufferedAtomic<T_Type, T_ParallelToolbox>), CODI_T(BufferedAtomic<double, CODI_ANY>));
+
+      static CODI_INLINE bool isTotalZero(Type const& v) {
+        return typename Type::Type() == v;
+      }
+  };
+#endif
+}
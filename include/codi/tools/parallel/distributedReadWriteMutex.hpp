@@ -0,0 +1,271 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <thread>
+
+#include "../../config.h"
+#include "../../misc/macros.hpp"
+#include "atomicInterface.hpp"
+#include "readWriteMutex.hpp"
+#include "threadInformationInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Reader-biased read-write mutex with distributed reader registration.
+   *
+   * Behaves like ReadWriteMutex, but each thread registers as a reader in its own slot instead of incrementing a shared
+   * reader counter. Slots are padded to Config::CacheLineSize, such that concurrent lockRead and unlockRead calls of
+   * different threads do not touch the same cache line. The price is paid by writers, which have to visit the slots of
+   * all threads that have ever locked for read before they may proceed. This is a good fit for locks that are taken for read very frequently and for
+   * write only rarely, like the lock that protects the reallocation of the adjoint vector in ThreadSafeGlobalAdjoints.
+   *
+   * Writers are preferred: as soon as a writer has registered, no new readers are admitted until it is done. Waiting
+   * threads spin with exponential backoff and eventually yield the processor.
+   *
+   * The user is responsible for correct pairing of lockForRead, unlockForRead and lockForWrite, unlockForWrite,
+   * respectively. Use of the RAII locks LockForRead and LockForWrite is advised.
+   *
+   * Recursive locking for read is supported.
+   *
+   * @tparam T_ThreadInformation Implementation of ThreadInformationInterface.
+   * @tparam T_AtomicInt  Implementation of AtomicInterface, instantiated with an underlying integer type.
+   */
+  template<typename T_ThreadInformation, typename T_AtomicInt>
+  struct DistributedReadWriteMutex {
+    public:
+      /// See DistributedReadWriteMutex.
+      using ThreadInformation = CODI_DD(T_ThreadInformation, ThreadInformationInterface);
+      using AtomicInt = CODI_DD(T_AtomicInt, CODI_DEFAULT_ATOMIC<int>);  ///< See DistributedReadWriteMutex.
+
+    private:
+
+      /// Per-thread reader registration. Only the owning thread modifies nestingDepth and used.
+      struct ReaderSlot {
+        public:
+          AtomicInt active;
+          int nestingDepth;
+          bool used;
+
+          ReaderSlot() : active(0), nestingDepth(0), used(false) {}
+      };
+
+      /// Distance between two reader slots in bytes, a multiple of the cache line size.
+      static size_t constexpr SlotStride =
+          (sizeof(ReaderSlot) + Config::CacheLineSize - 1) / Config::CacheLineSize * Config::CacheLineSize;
+
+      /// Number of spin iterations after which waiting threads yield instead of spinning further.
+      static int constexpr MaxSpins = 1024;
+
+      AtomicInt numWriters;
+      AtomicInt numUsedSlots;  ///< Upper bound for the ids of all threads that have locked for read so far.
+      int numSlots;
+      char* slotMemory;
+      char* slotBase;
+
+#ifdef __SANITIZE_THREAD__
+      int dummy;
+#endif
+
+    public:
+      /// Constructor
+      CODI_INLINE DistributedReadWriteMutex()
+          : numWriters(0),
+            numUsedSlots(0),
+            numSlots(ThreadInformation::getMaxThreads()),
+            slotMemory(new char[numSlots * SlotStride + Config::CacheLineSize]),
+            slotBase(alignToCacheLine(slotMemory))
+#ifdef __SANITIZE_THREAD__
+            ,
+            dummy(0)
+#endif
+      {
+        for (int i = 0; i < numSlots; i += 1) {
+          new (slotBase + i * SlotStride) ReaderSlot();
+        }
+
+#ifdef __SANITIZE_THREAD__
+        ANNOTATE_RWLOCK_CREATE(&dummy);
+#endif
+      }
+
+      /// Destructor
+      ~DistributedReadWriteMutex() {
+        for (int i = 0; i < numSlots; i += 1) {
+          getSlot(i).~ReaderSlot();
+        }
+        delete[] slotMemory;
+
+#ifdef __SANITIZE_THREAD__
+        ANNOTATE_RWLOCK_DESTROY(&dummy);
+#endif
+      }
+
+      /**
+       * @brief Acquire mutex for read access.
+       *
+       * Waits until there are no writers. Multiple simultaneous acquisitions for reading are allowed.
+       */
+      void lockRead() {
+        int const threadId = ThreadInformation::getThreadId();
+        ReaderSlot& slot = getSlot(threadId);
+
+        if (!slot.used) {
+          // make the slot visible to writers before it is used for the first time
+          int currentUsedSlots = numUsedSlots;
+          while (currentUsedSlots <= threadId) {
+            currentUsedSlots = ++numUsedSlots;
+          }
+          slot.used = true;
+        }
+
+        if (slot.nestingDepth > 0) {
+          // nested lock for read
+          ++slot.nestingDepth;
+        } else {
+          int spins = 1;
+          while (true) {
+            // wait until there are no writers
+            waitWhileNonZero(numWriters, spins);
+            // register reader
+            ++slot.active;
+            // success if there are still no writers
+            int currentWriters = numWriters;
+            if (currentWriters == 0) {
+              slot.nestingDepth = 1;
+              break;
+            }
+            // otherwise let writers go first and try again
+            --slot.active;
+          }
+        }
+
+#ifdef __SANITIZE_THREAD__
+        ANNOTATE_RWLOCK_ACQUIRED(&dummy, false);
+#endif
+      }
+
+      /// Release mutex that was acquired for read access.
+      void unlockRead() {
+#ifdef __SANITIZE_THREAD__
+        ANNOTATE_RWLOCK_RELEASED(&dummy, false);
+#endif
+        ReaderSlot& slot = getSlot(ThreadInformation::getThreadId());
+        --slot.nestingDepth;
+        if (slot.nestingDepth == 0) {
+          --slot.active;
+        }
+      }
+
+      /**
+       * @brief Acquire mutex for write access.
+       *
+       * First writer comes first and blocks new readers. It proceeds as soon as all registered readers are done. Other
+       * writers, if any, wait until the first one is done.
+       */
+      void lockWrite() {
+        int spins = 1;
+        while (true) {
+          // register writer, success if we are the first/only writer
+          int currentWriters = ++numWriters;
+          if (currentWriters == 1) {
+            break;
+          }
+          // otherwise try again
+          --numWriters;
+          backoff(spins);
+        }
+
+        // wait until all readers are done, only slots that have been used can be active
+        int usedSlots = numUsedSlots;
+        if (usedSlots > numSlots) {
+          usedSlots = numSlots;
+        }
+        for (int i = 0; i < usedSlots; i += 1) {
+          spins = 1;
+          waitWhileNonZero(getSlot(i).active, spins);
+        }
+
+#ifdef __SANITIZE_THREAD__
+        ANNOTATE_RWLOCK_ACQUIRED(&dummy, true);
+#endif
+      }
+
+      /// Release mutex that was acquired for write access.
+      void unlockWrite() {
+#ifdef __SANITIZE_THREAD__
+        ANNOTATE_RWLOCK_RELEASED(&dummy, true);
+#endif
+
+        --numWriters;
+      }
+
+    private:
+
+      static CODI_INLINE char* alignToCacheLine(char* memory) {
+        size_t const offset = reinterpret_cast<size_t>(memory) % Config::CacheLineSize;
+        return 0 == offset ? memory : memory + (Config::CacheLineSize - offset);
+      }
+
+      CODI_INLINE ReaderSlot& getSlot(int threadId) {
+        return *reinterpret_cast<ReaderSlot*>(slotBase + threadId * SlotStride);
+      }
+
+      static CODI_INLINE void waitWhileNonZero(AtomicInt const& value, int& spins) {
+        int current = value;
+        while (0 != current) {
+          backoff(spins);
+          current = value;
+        }
+      }
+
+      static CODI_INLINE void backoff(int& spins) {
+        if (spins < MaxSpins) {
+          for (int i = 0; i < spins; i += 1) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_ia32_pause();
+#endif
+          }
+          spins *= 2;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+  };
+}
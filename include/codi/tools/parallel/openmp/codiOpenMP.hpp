@@ -39,6 +39,7 @@
 #include "../../../tapes/indices/parallelReuseIndexManager.hpp"
 #include "../../../tapes/misc/threadSafeGlobalAdjoints.hpp"
 #include "../../data/direction.hpp"
+#include "../bufferedAtomic.hpp"
 #include "openMPAtomic.hpp"
 #include "openMPMutex.hpp"
 #include "openMPStaticThreadLocalPointer.hpp"
@@ -74,4 +75,14 @@ namespace codi {
   /// \copydoc codi::RealReverseIndexOpenMPGen
   template<size_t dim>
   using RealReverseIndexVecOpenMP = RealReverseIndexOpenMPGen<double, Direction<OpenMPAtomic<double>, dim>>;
+
+  /// \copydoc codi::RealReverseIndexOpenMPGen <br><br>
+  /// Updates each adjoint direction with a single compare-and-swap if it fits into a lock-free word, see the
+  /// OpenMPAtomicImpl specialization for Direction.
+  template<size_t dim>
+  using RealReverseIndexAtomicVecOpenMP = RealReverseIndexOpenMPGen<double, OpenMPAtomic<Direction<double, dim>>>;
+
+  /// \copydoc codi::RealReverseIndexOpenMPGen <br><br>
+  /// Uses BufferedAtomic gradients, such that updates of hot adjoint variables can be accumulated thread-locally.
+  using RealReverseIndexBufferedOpenMP = RealReverseIndexOpenMPGen<double, BufferedAtomic<double, OpenMPToolbox>>;
 }
@@ -34,12 +34,16 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 #include "../../../expressions/activeType.hpp"
 #include "../../../traits/atomicTraits.hpp"
+#include "../../../traits/gradientTraits.hpp"
 #include "../../../traits/realTraits.hpp"
 #include "../../../traits/tapeTraits.hpp"
+#include "../../data/direction.hpp"
 #include "../atomicInterface.hpp"
 #include "macros.hpp"
 
@@ -49,8 +53,8 @@ namespace codi {
   /**
    * @brief Atomic implementation for OpenMP.
    *
-   * OpenMP atomics are disabled for all types by default. Atomics for arithmetic types and forward CoDiPack types are
-   * enabled by specializations.
+   * OpenMP atomics are disabled for all types by default. Atomics for arithmetic types, forward CoDiPack types and
+   * Direction types with arithmetic entries are enabled by specializations.
    *
    * See also AtomicInterface.
    *
@@ -233,6 +237,154 @@ namespace codi {
       }
   };
 
+  // Unsigned integer type for a compare-and-swap on size bytes, if the compiler provides a lock-free one.
+  template<size_t size>
+  struct OpenMPAtomicCasWord {
+      static bool constexpr available = false;
+      using Type = void;
+  };
+
+  #ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_4
+  template<>
+  struct OpenMPAtomicCasWord<4> {
+      static bool constexpr available = true;
+      using Type = uint32_t;
+  };
+  #endif
+
+  #ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_8
+  template<>
+  struct OpenMPAtomicCasWord<8> {
+      static bool constexpr available = true;
+      using Type = uint64_t;
+  };
+  #endif
+
+  #ifdef __GCC_HAVE_SYNC_COMPARE_AND_SWAP_16
+  template<>
+  struct OpenMPAtomicCasWord<16> {
+      static bool constexpr available = true;
+      __extension__ typedef unsigned __int128 Type;
+  };
+  #endif
+
+  // Enable if for Direction types with arithmetic entries.
+  template<typename T_Type>
+  using OpenMPAtomicEnableIfDirection = typename std::enable_if<GradientTraits::IsDirection<T_Type>::value &&
+                                                                std::is_arithmetic<typename T_Type::Real>::value>::type;
+
+  // Specialization for Direction types with arithmetic entries. Updates the whole direction with a single
+  // compare-and-swap if it fits into a lock-free word of at most 16 bytes, and with individual atomic updates of the
+  // entries otherwise. Reads and writes act on the entries individually.
+  template<typename T_Type>
+  struct alignas(OpenMPAtomicCasWord<sizeof(T_Type)>::available ? sizeof(T_Type) : alignof(T_Type))
+      OpenMPAtomicImpl<T_Type, OpenMPAtomicEnableIfDirection<T_Type>>
+      : public AtomicInterface<T_Type, OpenMPAtomicImpl<T_Type, OpenMPAtomicEnableIfDirection<T_Type>>>,
+        public T_Type {
+    public:
+      using Type = CODI_DD(T_Type, CODI_T(Direction<double, 1>));
+      using Base = AtomicInterface<T_Type, OpenMPAtomicImpl<T_Type, OpenMPAtomicEnableIfDirection<T_Type>>>;
+      using Real = typename Type::Real;
+      using CasWord = OpenMPAtomicCasWord<sizeof(Type)>;
+
+      static size_t constexpr dim = Type::dim;
+
+    private:
+      CODI_INLINE Type& direction() {
+        return static_cast<Type&>(*this);
+      }
+
+      CODI_INLINE Type const& direction() const {
+        return static_cast<Type const&>(*this);
+      }
+
+      CODI_INLINE void atomicSetValue(Type const& newValue) {
+        for (size_t i = 0; i < dim; ++i) {
+          *reinterpret_cast<OpenMPAtomicImpl<Real>*>(&direction()[i]) = newValue[i];
+        }
+      }
+
+      CODI_INLINE Type atomicGetValue() const {
+        Type result;
+        for (size_t i = 0; i < dim; ++i) {
+          result[i] = *reinterpret_cast<OpenMPAtomicImpl<Real> const*>(&direction()[i]);
+        }
+        return result;
+      }
+
+      template<typename Word>
+      CODI_INLINE void atomicAdd(Type const& other, std::true_type /* casAvailable */) {
+        static_assert(sizeof(Word) == sizeof(Real[dim]), "Compare-and-swap word has to cover the whole direction.");
+
+        Word* word = reinterpret_cast<Word*>(&direction()[0]);
+
+        // Start with an entrywise read. If it is not consistent, the first compare-and-swap fails and corrects it.
+        Real current[dim];
+        for (size_t i = 0; i < dim; ++i) {
+          current[i] = *reinterpret_cast<OpenMPAtomicImpl<Real> const*>(&direction()[i]);
+        }
+        Word expected;
+        std::memcpy(&expected, current, sizeof(Word));
+
+        while (true) {
+          Real updated[dim];
+          for (size_t i = 0; i < dim; ++i) {
+            updated[i] = current[i] + other[i];
+          }
+          Word desired;
+          std::memcpy(&desired, updated, sizeof(Word));
+
+          Word const previous = __sync_val_compare_and_swap(word, expected, desired);
+          if (previous == expected) {
+            break;
+          }
+
+          expected = previous;
+          std::memcpy(current, &expected, sizeof(Word));
+        }
+      }
+
+      template<typename Word>
+      CODI_INLINE void atomicAdd(Type const& other, std::false_type /* casAvailable */) {
+        for (size_t i = 0; i < dim; ++i) {
+          *reinterpret_cast<OpenMPAtomicImpl<Real>*>(&direction()[i]) += other[i];
+        }
+      }
+
+    public:
+      CODI_INLINE OpenMPAtomicImpl() : Base(), Type() {}
+
+      CODI_INLINE OpenMPAtomicImpl(OpenMPAtomicImpl const& other) : Base(), Type() {
+        atomicSetValue(other.atomicGetValue());
+      }
+
+      CODI_INLINE OpenMPAtomicImpl(Type const& other) : Base(), Type() {
+        atomicSetValue(other);
+      }
+
+      CODI_INLINE OpenMPAtomicImpl& operator=(OpenMPAtomicImpl const& other) {
+        return operator=(other.atomicGetValue());
+      }
+
+      CODI_INLINE OpenMPAtomicImpl& operator=(Type const& other) {
+        atomicSetValue(other);
+        return *this;
+      }
+
+      CODI_INLINE OpenMPAtomicImpl& operator+=(OpenMPAtomicImpl const& other) {
+        return operator+=(other.atomicGetValue());
+      }
+
+      CODI_INLINE OpenMPAtomicImpl& operator+=(Type const& other) {
+        atomicAdd<typename CasWord::Type>(other, std::integral_constant<bool, CasWord::available>());
+        return *this;
+      }
+
+      CODI_INLINE operator Type() const {
+        return atomicGetValue();
+      }
+  };
+
 #endif
 
   /// Wrapper for atomics for OpenMP.
@@ -259,5 +411,23 @@ namespace codi {
         return typename Type::Type() == v;
       }
   };
+
+  // Specialize IsTotalZero for OpenMPAtomic on Direction types.
+  template<typename T_Type>
+  struct RealTraits::IsTotalZero<OpenMPAtomicImpl<T_Type, OpenMPAtomicEnableIfDirection<T_Type>>> {
+    public:
+
+      using Type = CODI_DD(CODI_T(OpenMPAtomicImpl<T_Type, OpenMPAtomicEnableIfDirection<T_Type>>),
+                           CODI_T(OpenMPAtomic<Direction<double, 1>>));
+
+      static CODI_INLINE bool isTotalZero(Type const& v) {
+        return RealTraits::isTotalZero(static_cast<T_Type const&>(v));
+      }
+  };
+
+  // Gradient traits for OpenMPAtomic on Direction types are the ones of the underlying Direction.
+  template<typename T_Type>
+  struct GradientTraits::TraitsImplementation<OpenMPAtomicImpl<T_Type, OpenMPAtomicEnableIfDirection<T_Type>>>
+      : public GradientTraits::TraitsImplementation<T_Type> {};
 #endif
 }
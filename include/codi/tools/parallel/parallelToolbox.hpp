@@ -35,6 +35,7 @@
 #pragma once
 
 #include "atomicInterface.hpp"
+#include "distributedReadWriteMutex.hpp"
 #include "mutexInterface.hpp"
 #include "readWriteMutex.hpp"
 #include "staticThreadLocalPointerInterface.hpp"
@@ -84,6 +85,11 @@ namespace codi {
       using ReadWriteMutex = codi::ReadWriteMutex<ThreadInformation, Atomic<int>>;  ///< See codi::ReadWriteMutex.
       using LockForRead = codi::LockForRead<ReadWriteMutex>;                        ///< See codi::LockForRead.
       using LockForWrite = codi::LockForWrite<ReadWriteMutex>;                      ///< See codi::LockForWrite.
+
+      /// See codi::DistributedReadWriteMutex.
+      using DistributedReadWriteMutex = codi::DistributedReadWriteMutex<ThreadInformation, Atomic<int>>;
+      using LockForDistributedRead = codi::LockForRead<DistributedReadWriteMutex>;    ///< See codi::LockForRead.
+      using LockForDistributedWrite = codi::LockForWrite<DistributedReadWriteMutex>;  ///< See codi::LockForWrite.
   };
 
 #if CODI_IDE
@@ -0,0 +1,84 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include "../../../../codi.hpp"
+#include "../../../expressions/parallelActiveType.hpp"
+#include "../../../tapes/indices/parallelReuseIndexManager.hpp"
+#include "../../../tapes/misc/threadSafeGlobalAdjoints.hpp"
+#include "../../data/direction.hpp"
+#include "../bufferedAtomic.hpp"
+#include "../synchronizationInterface.hpp"
+#include "stdAtomic.hpp"
+#include "stdMutex.hpp"
+#include "stdStaticThreadLocalPointer.hpp"
+#include "stdThreadInformation.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Parallel toolbox based on the C++ standard library, for use with std::thread and thread pools.
+   *
+   * Threads created with std::thread do not form teams, so there is no notion of jointly working on an external
+   * function. The serial DefaultSynchronization is used, that is, each thread handles its external functions on its
+   * own.
+   */
+  using StdToolbox = ParallelToolbox<StdThreadInformation, StdAtomic, StdMutex, StdStaticThreadLocalPointer,
+                                     DefaultSynchronization>;
+
+  /// Thread-safe global adjoints for std::thread.
+  template<typename Gradient, typename Identifier, typename Tape>
+  using StdGlobalAdjoints = ThreadSafeGlobalAdjoints<Gradient, Identifier, Tape, StdToolbox>;
+
+  /// \copydoc codi::RealReverseIndexGen <br><br>
+  /// This a thread-safe implementation for use with std::thread that does not require an OpenMP runtime.
+  template<typename Real, typename Gradient = StdAtomic<Real>,
+           typename IndexManager = ParallelReuseIndexManager<int, StdToolbox>>
+  using RealReverseIndexStdGen = ParallelActiveType<
+      JacobianReuseTape<JacobianTapeTypes<Real, Gradient, IndexManager, DefaultChunkedData, StdGlobalAdjoints>>,
+      StdToolbox>;
+
+  /// \copydoc codi::RealReverseIndexStdGen
+  using RealReverseIndexStd = RealReverseIndexStdGen<double>;
+
+  /// \copydoc codi::RealReverseIndexStdGen
+  template<size_t dim>
+  using RealReverseIndexVecStd = RealReverseIndexStdGen<double, Direction<StdAtomic<double>, dim>>;
+
+  /// \copydoc codi::RealReverseIndexStdGen <br><br>
+  /// Uses BufferedAtomic gradients, such that updates of hot adjoint variables can be accumulated thread-locally.
+  using RealReverseIndexBufferedStd = RealReverseIndexStdGen<double, BufferedAtomic<double, StdToolbox>>;
+}
@@ -0,0 +1,244 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "../../../expressions/activeType.hpp"
+#include "../../../traits/atomicTraits.hpp"
+#include "../../../traits/realTraits.hpp"
+#include "../../../traits/tapeTraits.hpp"
+#include "../atomicInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Atomic implementation based on std::atomic.
+   *
+   * Atomics are disabled for all types by default. Atomics for arithmetic types and forward CoDiPack types are enabled
+   * by specializations. Floating point updates are implemented by compare-and-swap loops since std::atomic provides
+   * fetch_add for floating point types only from C++20 on.
+   *
+   * See also AtomicInterface.
+   *
+   * @tparam T_Type    The underlying data type.
+   * @tparam T_Sfinae  Additional SFNIAE parameter for enable-if constructs.
+   */
+  template<typename T_Type, typename T_Sfinae = void>
+  struct StdAtomicImpl : public AtomicInterface<T_Type, StdAtomicImpl<T_Type, T_Sfinae>> {
+    public:
+      using Type = T_Type;  ///< See StdAtomicImpl.
+
+      StdAtomicImpl() = delete;  ///< Constructor is deleted, will throw errors for unspecialized instantiations.
+  };
+
+#ifndef DOXYGEN_DISABLE
+
+  // Specialization for arithmetic types.
+  template<typename T_Type>
+  struct StdAtomicImpl<T_Type, typename std::enable_if<std::is_arithmetic<T_Type>::value>::type>
+      : public AtomicInterface<
+            T_Type, StdAtomicImpl<T_Type, typename std::enable_if<std::is_arithmetic<T_Type>::value>::type>> {
+    public:
+      using Type = T_Type;
+      using Base =
+          AtomicInterface<T_Type,
+                          StdAtomicImpl<T_Type, typename std::enable_if<std::is_arithmetic<T_Type>::value>::type>>;
+
+    private:
+      std::atomic<Type> value;
+
+      CODI_INLINE Type add(Type const& other, std::true_type /* isIntegral */) {
+        return value.fetch_add(other) + other;
+      }
+
+      CODI_INLINE Type add(Type const& other, std::false_type /* isIntegral */) {
+        Type expected = value.load();
+        while (!value.compare_exchange_weak(expected, expected + other)) {
+        }
+        return expected + other;
+      }
+
+    public:
+      CODI_INLINE StdAtomicImpl() : Base(), value(Type()) {}
+
+      CODI_INLINE StdAtomicImpl(StdAtomicImpl const& other) : Base(), value(other.value.load()) {}
+
+      CODI_INLINE StdAtomicImpl(Type const& other) : Base(), value(other) {}
+
+      CODI_INLINE StdAtomicImpl& operator=(StdAtomicImpl const& other) {
+        return operator=(other.value.load());
+      }
+
+      CODI_INLINE StdAtomicImpl& operator=(Type const& other) {
+        value.store(other);
+        return *this;
+      }
+
+      CODI_INLINE Type operator+=(StdAtomicImpl const& other) {
+        return operator+=(other.value.load());
+      }
+
+      CODI_INLINE Type operator+=(Type const& other) {
+        return add(other, std::is_integral<Type>());
+      }
+
+      CODI_INLINE Type operator++() {
+        return add(Type(1), std::is_integral<Type>());
+      }
+
+      CODI_INLINE Type operator++(int) {
+        return add(Type(1), std::is_integral<Type>()) - Type(1);
+      }
+
+      CODI_INLINE Type operator--() {
+        return add(Type(-1), std::is_integral<Type>());
+      }
+
+      CODI_INLINE Type operator--(int) {
+        return add(Type(-1), std::is_integral<Type>()) + Type(1);
+      }
+
+      CODI_INLINE operator Type() const {
+        return value.load();
+      }
+  };
+
+  // Specialization for forward CoDiPack types. Acts on value and gradient with individual atomic operations.
+  template<typename T_Type>
+  struct StdAtomicImpl<T_Type, TapeTraits::EnableIfForwardTape<typename T_Type::Tape>>
+      : public AtomicInterface<T_Type, StdAtomicImpl<T_Type, TapeTraits::EnableIfForwardTape<typename T_Type::Tape>>>,
+        public T_Type {
+    public:
+      using Type = CODI_DD(T_Type, CODI_DEFAULT_LHS_EXPRESSION);
+      using Base =
+          AtomicInterface<T_Type, StdAtomicImpl<T_Type, TapeTraits::EnableIfForwardTape<typename T_Type::Tape>>>;
+      using Tape = typename Type::Tape;
+      using Real = typename Type::Real;
+      using Gradient = typename Type::Gradient;
+
+      static_assert(sizeof(StdAtomicImpl<Real>) == sizeof(Real) && sizeof(StdAtomicImpl<Gradient>) == sizeof(Gradient),
+                    "std::atomic has to be layout compatible with the value and gradient type.");
+
+    private:
+      CODI_INLINE void atomicSetValue(Type const& newValue) {
+        StdAtomicImpl<Real>* atomicValue = reinterpret_cast<StdAtomicImpl<Real>*>(&this->value());
+        StdAtomicImpl<Gradient>* atomicGradient = reinterpret_cast<StdAtomicImpl<Gradient>*>(&this->gradient());
+
+        *atomicValue = newValue.value();
+        *atomicGradient = newValue.gradient();
+      }
+
+      CODI_INLINE Type atomicGetValue() const {
+        Type result;
+
+        StdAtomicImpl<Real> const* atomicValue = reinterpret_cast<StdAtomicImpl<Real> const*>(&this->value());
+        StdAtomicImpl<Gradient> const* atomicGradient =
+            reinterpret_cast<StdAtomicImpl<Gradient> const*>(&this->gradient());
+
+        result.value() = *atomicValue;
+        result.gradient() = *atomicGradient;
+
+        return result;
+      }
+
+    public:
+      CODI_INLINE StdAtomicImpl() : Base(), Type() {}
+
+      CODI_INLINE StdAtomicImpl(StdAtomicImpl const& other) : Base(), Type() {
+        atomicSetValue(other.atomicGetValue());
+      }
+
+      CODI_INLINE StdAtomicImpl(Type const& other) : Base(), Type() {
+        atomicSetValue(other);
+      }
+
+      CODI_INLINE StdAtomicImpl& operator=(StdAtomicImpl const& other) {
+        return operator=(other.atomicGetValue());
+      }
+
+      CODI_INLINE StdAtomicImpl& operator=(Type const& other) {
+        atomicSetValue(other);
+        return *this;
+      }
+
+      CODI_INLINE StdAtomicImpl& operator+=(StdAtomicImpl const& other) {
+        return operator+=(other.atomicGetValue());
+      }
+
+      CODI_INLINE StdAtomicImpl& operator+=(Type const& other) {
+        StdAtomicImpl<Real>* atomicValue = reinterpret_cast<StdAtomicImpl<Real>*>(&this->value());
+        StdAtomicImpl<Gradient>* atomicGradient = reinterpret_cast<StdAtomicImpl<Gradient>*>(&this->gradient());
+
+        *atomicValue += other.value();
+        *atomicGradient += other.gradient();
+        return *this;
+      }
+
+      CODI_INLINE operator Type() const {
+        return atomicGetValue();
+      }
+  };
+
+#endif
+
+  /// Wrapper for atomics based on std::atomic.
+  /// @tparam Type  An arithmetic type or CoDiPack forward type.
+  template<typename Type>
+  using StdAtomic = StdAtomicImpl<Type>;
+
+  /// Declare StdAtomic to be atomic in terms of AtomicTraits.
+  template<typename T_Type>
+  struct AtomicTraits::IsAtomic<StdAtomic<T_Type>> : std::true_type {};
+
+#ifndef DOXYGEN_DISABLE
+  // Specialize IsTotalZero for StdAtomic on arithmetic types.
+  template<typename T_Type>
+  struct RealTraits::IsTotalZero<
+      StdAtomicImpl<T_Type, typename std::enable_if<std::is_arithmetic<T_Type>::value>::type>> {
+    public:
+
+      using Type =
+          CODI_DD(CODI_T(StdAtomicImpl<T_Type, typename std::enable_if<std::is_arithmetic<T_Type>::value>::type>),
+                  StdAtomic<double>);
+
+      static CODI_INLINE bool isTotalZero(Type const& v) {
+        return typename Type::Type() == v;
+      }
+  };
+#endif
+}
@@ -0,0 +1,113 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <mutex>
+#include <vector>
+
+#include "../../../misc/exceptions.hpp"
+#include "../threadInformationInterface.hpp"
+
+/** \copydoc codi::Namespace */
+namespace codi {
+
+  /**
+   * @brief Thread information for threads created with std::thread.
+   *
+   * Contrary to OpenMP, the standard library does not number threads. Each thread is assigned an id in the range
+   * 0, 1, ..., getMaxThreads() - 1 when it first asks for it. The id is returned to a pool when the thread terminates
+   * and may be handed out to a thread that is created later on. Hence, thread pools and short-lived threads are both
+   * supported as long as no more than getMaxThreads() threads are alive at the same time.
+   */
+  struct StdThreadInformation : public ThreadInformationInterface {
+    private:
+
+      /// Pool of thread ids, shared among all threads.
+      struct IdPool {
+        public:
+          std::mutex mutex;
+          std::vector<int> freeIds;
+          int nextId;
+
+          IdPool() : mutex(), freeIds(), nextId(0) {}
+      };
+
+      /// Holds the id of one thread for the lifetime of the thread.
+      struct IdHolder {
+        public:
+          int id;
+
+          IdHolder() : id(0) {
+            IdPool& pool = getIdPool();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+
+            if (pool.freeIds.empty()) {
+              if (pool.nextId >= getMaxThreads()) {
+                CODI_EXCEPTION("More than %d threads are used with StdThreadInformation.", getMaxThreads());
+              }
+              id = pool.nextId;
+              pool.nextId += 1;
+            } else {
+              id = pool.freeIds.back();
+              pool.freeIds.pop_back();
+            }
+          }
+
+          ~IdHolder() {
+            IdPool& pool = getIdPool();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            pool.freeIds.push_back(id);
+          }
+      };
+
+      static CODI_INLINE IdPool& getIdPool() {
+        static IdPool pool;
+        return pool;
+      }
+
+    public:
+
+      /// \copydoc ThreadInformationInterface::getMaxThreads()
+      static CODI_INLINE int getMaxThreads() {
+        return 512;
+      }
+
+      /// \copydoc ThreadInformationInterface::getThreadId()
+      static CODI_INLINE int getThreadId() {
+        static thread_local IdHolder holder;
+        return holder.id;
+      }
+  };
+}
@@ -99,13 +99,15 @@ namespace codi {
 
     /// \copydoc codi::GradientTraits::TraitsImplementation::at()
     template<typename Gradient>
-    CODI_INLINE typename TraitsImplementation<Gradient>::Real& at(Gradient& gradient, size_t dim) {
+    CODI_INLINE auto at(Gradient& gradient, size_t dim)
+        -> decltype(TraitsImplementation<Gradient>::at(gradient, dim)) {
       return TraitsImplementation<Gradient>::at(gradient, dim);
     }
 
     /// \copydoc codi::GradientTraits::TraitsImplementation::at()
     template<typename Gradient>
-    CODI_INLINE typename TraitsImplementation<Gradient>::Real const& at(Gradient const& gradient, size_t dim) {
+    CODI_INLINE auto at(Gradient const& gradient, size_t dim)
+        -> decltype(TraitsImplementation<Gradient>::at(gradient, dim)) {
       return TraitsImplementation<Gradient>::at(gradient, dim);
     }
 
@@ -0,0 +1,157 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_IDE 0
+#define CODI_EnableOpenMP true
+
+#include <codi.hpp>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+int const NumThreads = 8;
+int const NumInputs = 4;
+size_t const Dim = 2;
+
+/// All threads increment the same atomic direction. The entries are integers, so the result is exact.
+template<typename Real, size_t dim>
+bool testConcurrentUpdates() {
+  using Direction = codi::Direction<Real, dim>;
+  int const iterations = 10000;
+
+  codi::OpenMPAtomic<Direction> sum;
+#pragma omp parallel num_threads(NumThreads)
+  {
+    Direction increment;
+    for (size_t k = 0; k < dim; k += 1) {
+      increment[k] = (Real)(k + 1);
+    }
+    for (int i = 0; i < iterations; i += 1) {
+      sum += increment;
+    }
+  }
+
+  Direction const result = sum;
+  for (size_t k = 0; k < dim; k += 1) {
+    if ((Real)(NumThreads * iterations * (k + 1)) != result[k]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Records on all threads with shared inputs and evaluates all directions in parallel. Returns the input gradients.
+template<typename Real>
+std::vector<double> parallelGradients() {
+  using Tape = typename Real::Tape;
+
+  Tape& masterTape = Real::getTape();
+  Real x[NumInputs];
+  Real y[NumThreads];
+
+  masterTape.setActive();
+  for (int i = 0; i < NumInputs; i += 1) {
+    x[i] = 1.0 + 0.5 * i;
+    masterTape.registerInput(x[i]);
+  }
+
+#pragma omp parallel num_threads(NumThreads)
+  {
+    int const threadNumber = omp_get_thread_num();
+    Tape& tape = Real::getTape();
+    tape.setActive();
+
+    Real w = threadNumber;
+    for (int i = 0; i < 100; i += 1) {
+      w = 0.5 * w + x[i % NumInputs] * x[(i + threadNumber) % NumInputs];
+    }
+    y[threadNumber] = w;
+    tape.registerOutput(y[threadNumber]);
+    tape.setPassive();
+  }
+  masterTape.setPassive();
+
+  // Size the adjoint vector beforehand, seeding must not resize it while other threads evaluate.
+  masterTape.resizeAdjointVector();
+
+#pragma omp parallel num_threads(NumThreads)
+  {
+    int const threadNumber = omp_get_thread_num();
+    Tape& tape = Real::getTape();
+    for (size_t k = 0; k < Dim; k += 1) {
+      codi::GradientTraits::at(y[threadNumber].gradient(), k) = (double)(k + 1);
+    }
+    tape.evaluate();
+  }
+
+  std::vector<double> gradients;
+  for (int i = 0; i < NumInputs; i += 1) {
+    for (size_t k = 0; k < Dim; k += 1) {
+      gradients.push_back(codi::GradientTraits::at(x[i].getGradient(), k));
+    }
+  }
+
+#pragma omp parallel num_threads(NumThreads)
+  {
+    Real::getTape().reset();
+  }
+
+  return gradients;
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  out << "Concurrent updates, Direction<double, 1>: " << testConcurrentUpdates<double, 1>() << std::endl;
+  out << "Concurrent updates, Direction<float, 2>: " << testConcurrentUpdates<float, 2>() << std::endl;
+  out << "Concurrent updates, Direction<double, 2>: " << testConcurrentUpdates<double, 2>() << std::endl;
+  out << "Concurrent updates, Direction<double, 4>: " << testConcurrentUpdates<double, 4>() << std::endl;
+
+  std::vector<double> reference = parallelGradients<codi::RealReverseIndexVecOpenMP<Dim>>();
+  std::vector<double> atomic = parallelGradients<codi::RealReverseIndexAtomicVecOpenMP<Dim>>();
+
+  bool match = true;
+  for (size_t i = 0; i < reference.size(); i += 1) {
+    if (1e-12 * std::abs(reference[i]) < std::abs(reference[i] - atomic[i])) {
+      match = false;
+    }
+  }
+  out << "Parallel reverse sweep, atomic directions match directions of atomics: " << match << std::endl;
+
+  out.close();
+
+  return 0;
+}
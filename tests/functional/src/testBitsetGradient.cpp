@@ -0,0 +1,131 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+#include <fstream>
+#include <iostream>
+
+size_t constexpr InputCount = 4;
+size_t constexpr OutputCount = 3;
+
+template<typename Real>
+void func(Real const* x, Real* y) {
+  Real t = x[0] * x[1];
+  y[0] = t + 2.0 * x[0];
+  y[1] = sin(x[2]) - 0.0 * x[3];  // Exact zero factor: no dependency.
+  y[2] = x[3] / x[1] + (-x[3]);
+}
+
+template<typename Real>
+void runForward(std::ostream& out) {
+  Real x[InputCount] = {1.0, 2.0, 3.0, 4.0};
+  Real y[OutputCount];
+
+  for (size_t i = 0; i < InputCount; ++i) {
+    x[i].gradient().set(i);
+  }
+
+  func(x, y);
+
+  for (size_t i = 0; i < OutputCount; ++i) {
+    out << "  row " << i << ": " << y[i].getGradient() << " (" << y[i].getGradient().count() << ")" << std::endl;
+  }
+}
+
+template<typename Real>
+void runReverse(std::ostream& out) {
+  using Tape = typename Real::Tape;
+
+  Real x[InputCount] = {1.0, 2.0, 3.0, 4.0};
+  Real y[OutputCount];
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+  for (Real& value : x) {
+    tape.registerInput(value);
+  }
+
+  func(x, y);
+
+  for (Real& value : y) {
+    tape.registerOutput(value);
+  }
+  tape.setPassive();
+
+  for (size_t i = 0; i < OutputCount; ++i) {
+    y[i].gradient().set(i);
+  }
+  tape.evaluate();
+
+  for (size_t i = 0; i < InputCount; ++i) {
+    out << "  col " << i << ": " << x[i].getGradient();
+
+    // Element wise access through the vector access interface.
+    codi::VectorAccessInterface<typename Real::Real, typename Real::Identifier>* access = tape.createVectorAccess();
+    out << " [";
+    for (size_t d = 0; d < OutputCount; ++d) {
+      out << access->getAdjoint(x[i].getIdentifier(), d);
+    }
+    out << "]" << std::endl;
+    tape.deleteVectorAccess(access);
+  }
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  out << "Forward:" << std::endl;
+  runForward<codi::ActiveType<codi::ForwardEvaluation<double, codi::BitsetGradient<InputCount>>>>(out);
+
+  out << "Reverse Jacobian tape:" << std::endl;
+  runReverse<codi::RealReverseIndexGen<double, codi::BitsetGradient<OutputCount>>>(out);
+
+  out << "Reverse primal value tape:" << std::endl;
+  runReverse<codi::RealReversePrimalIndexGen<double, codi::BitsetGradient<OutputCount>>>(out);
+
+  codi::BitsetGradient<130> wide;
+  wide.set(0);
+  wide.set(64);
+  wide.set(129);
+  codi::BitsetGradient<130> full = 1.0;
+  out << "Wide: " << wide.count() << " " << (wide & full).count() << " " << full.count() << " "
+      << codi::RealTraits::isTotalZero(wide) << " " << codi::RealTraits::isTotalZero(codi::BitsetGradient<130>())
+      << std::endl;
+
+  out.close();
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_IDE 0
+#define CODI_EnableOpenMP true
+
+#include <codi.hpp>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <omp.h>
+#include <vector>
+
+using Real = codi::RealReverseIndexBufferedOpenMP;
+using Tape = typename Real::Tape;
+using Gradient = typename Real::Gradient;
+
+int const NumThreads = 4;
+int const NumInputs = 4;
+
+/// Each thread records a tape that reads all shared inputs. Identifiers of intermediates are reused.
+void record(Real* x, Real* y) {
+  Tape& masterTape = Real::getTape();
+  masterTape.setActive();
+  for (int i = 0; i < NumInputs; i += 1) {
+    x[i] = 1.0 + 0.5 * i;
+    masterTape.registerInput(x[i]);
+  }
+
+#pragma omp parallel num_threads(NumThreads)
+  {
+    int const threadNumber = omp_get_thread_num();
+    Tape& tape = Real::getTape();
+    tape.setActive();
+
+    Real w = threadNumber;
+    for (int i = 0; i < 100; i += 1) {
+      w = 0.5 * w + x[i % NumInputs] * x[(i + threadNumber) % NumInputs];
+    }
+    y[threadNumber] = w;
+    tape.registerOutput(y[threadNumber]);
+    tape.setPassive();
+  }
+
+  masterTape.setPassive();
+}
+
+/// Parallel reverse sweep of all thread tapes.
+void sweep(Real* y, bool reduce) {
+  // Size the adjoint vector beforehand, seeding must not resize it while other threads evaluate.
+  Real::getTape().resizeAdjointVector();
+
+#pragma omp parallel num_threads(NumThreads)
+  {
+    Tape& tape = Real::getTape();
+    y[omp_get_thread_num()].setGradient(1.0);
+    tape.evaluate();
+
+    if (reduce) {
+      Gradient::reduceThreadBuffer(tape);
+    }
+  }
+}
+
+/// Returns the input gradients and zeroes them.
+std::vector<double> collect(Real* x) {
+  std::vector<double> gradients(NumInputs);
+  for (int i = 0; i < NumInputs; i += 1) {
+    gradients[i] = x[i].getGradient();
+    x[i].setGradient(0.0);
+  }
+
+  return gradients;
+}
+
+std::vector<double> evaluate(Real* x, Real* y, bool reduce) {
+  sweep(y, reduce);
+  return collect(x);
+}
+
+bool match(std::vector<double> const& a, std::vector<double> const& b) {
+  for (size_t i = 0; i < a.size(); i += 1) {
+    if (1e-12 * std::abs(a[i]) < std::abs(a[i] - b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  Tape& tape = Real::getTape();
+
+  // Not global, the tapes must not be created during static initialization.
+  Real x[NumInputs];
+  Real y[NumThreads];
+
+  out << "sizeof(Gradient) == sizeof(double): " << (sizeof(Gradient) == sizeof(double)) << std::endl;
+
+  record(x, y);
+  std::vector<double> reference = evaluate(x, y, false);
+
+  // Gradients are read after the counting, otherwise the inputs are excluded.
+  Gradient::beginAccessCounting(tape);
+  sweep(y, false);
+  Gradient::endAccessCounting();
+  std::vector<double> counted = collect(x);
+  out << "Counting sweep matches: " << match(reference, counted) << std::endl;
+
+  size_t hot = Gradient::selectHotIdentifiers(tape, 2);
+  out << "Selected hot identifiers: " << hot << std::endl;
+
+  out << "Hot sweep without reduction matches: " << match(reference, evaluate(x, y, false)) << std::endl;
+  out << "Hot sweep with reduction matches: " << match(reference, evaluate(x, y, true)) << std::endl;
+
+  Gradient::beginAccessCounting(tape);
+  sweep(y, true);
+  Gradient::endAccessCounting();
+  collect(x);
+  hot = Gradient::selectHotIdentifiers(tape, 2, 2);
+  out << "Selected hot identifiers with bound 2: " << hot << std::endl;
+  out << "Bounded hot sweep matches: " << match(reference, evaluate(x, y, true)) << std::endl;
+
+  Gradient::clearHotIdentifiers(tape);
+  Gradient::markHot(tape, x[0].getIdentifier());
+  out << "Manually marked hot identifiers: " << Gradient::getNumberOfHotIdentifiers() << std::endl;
+  out << "Manual hot sweep matches: " << match(reference, evaluate(x, y, true)) << std::endl;
+
+  Gradient::clearHotIdentifiers(tape);
+
+  out.close();
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_IDE 0
+#define CODI_EnableOpenMP true
+#define CODI_DistributedAdjointsLock true
+
+#include <codi.hpp>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <omp.h>
+
+using Toolbox = codi::OpenMPToolbox;
+using Real = codi::RealReverseIndexOpenMP;
+using Tape = typename Real::Tape;
+
+int const NumThreads = 8;
+
+/// Readers check that a write phase is never observed halfway. Returns the number of violations.
+template<typename Mutex>
+int runContention(Mutex& mutex, int iterations, int writeEvery) {
+  int data[2] = {0, 0};
+  int violations = 0;
+
+#pragma omp parallel num_threads(NumThreads) reduction(+ : violations)
+  {
+    bool const isWriter = 0 == omp_get_thread_num();
+    for (int i = 0; i < iterations; i += 1) {
+      if (isWriter && 0 == i % writeEvery) {
+        codi::LockForWrite<Mutex> lock(mutex);
+        data[0] += 1;
+        data[1] += 1;
+      } else {
+        codi::LockForRead<Mutex> lock(mutex);
+        {
+          codi::LockForRead<Mutex> nested(mutex);
+          if (data[0] != data[1]) {
+            violations += 1;
+          }
+        }
+      }
+    }
+  }
+
+  return violations;
+}
+
+template<typename Mutex>
+double benchmark(int iterations) {
+  Mutex mutex;
+  auto start = std::chrono::steady_clock::now();
+  runContention(mutex, iterations, iterations);
+  auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  Toolbox::ReadWriteMutex mutex;
+  out << "Contention, ReadWriteMutex, violations: " << runContention(mutex, 100000, 100) << std::endl;
+  Toolbox::DistributedReadWriteMutex distributedMutex;
+  out << "Contention, DistributedReadWriteMutex, violations: " << runContention(distributedMutex, 100000, 100)
+      << std::endl;
+
+  // Parallel recording and evaluation, the global adjoint vector is resized while other threads use it.
+  int wrongGradients = 0;
+#pragma omp parallel num_threads(NumThreads) reduction(+ : wrongGradients)
+  {
+    Tape& tape = Real::getTape();
+    for (int run = 0; run < 20; run += 1) {
+      Real x = 1.0 + omp_get_thread_num();
+      tape.setActive();
+      tape.registerInput(x);
+      Real y = x;
+      for (int i = 0; i < 10 * (run + 1); i += 1) {
+        y = y * 1.0 + x;
+      }
+      tape.registerOutput(y);
+      tape.setPassive();
+
+      // Grows the adjoint vector while other threads evaluate.
+      tape.resizeAdjointVector();
+      tape.beginUseAdjointVector();
+      tape.gradient(y.getIdentifier(), codi::AdjointsManagement::Manual) = 1.0;
+      tape.endUseAdjointVector();
+
+      tape.evaluate();
+
+      tape.beginUseAdjointVector();
+      Real::Gradient& gradient = tape.gradient(x.getIdentifier(), codi::AdjointsManagement::Manual);
+      if ((double)gradient != 10.0 * (run + 1) + 1.0) {
+        wrongGradients += 1;
+      }
+      gradient = 0.0;
+      tape.endUseAdjointVector();
+
+      // Clearing all adjoints would interfere with the other threads.
+      tape.reset(false);
+    }
+  }
+  out << "Parallel taping with distributed adjoints lock, wrong gradients: " << wrongGradients << std::endl;
+
+  // Read-heavy benchmark, timings are reported on the console only.
+  int const benchmarkIterations = 1000000;
+  std::cout << "ReadWriteMutex: " << benchmark<Toolbox::ReadWriteMutex>(benchmarkIterations) << " s" << std::endl;
+  std::cout << "DistributedReadWriteMutex: " << benchmark<Toolbox::DistributedReadWriteMutex>(benchmarkIterations)
+            << " s" << std::endl;
+
+  out.close();
+
+  return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+#include <fstream>
+#include <iostream>
+
+using Interval = codi::Interval<double>;
+
+template<typename Real>
+Real func(Real const& x, Real const& y) {
+  Real a = x * y;
+  Real b = sin(x) + 1e-8 * exp(y);  // Small contribution of exp(y).
+  Real c = sqrt(a) / b;
+  Real d = pow(x, 3.0) - a * 2.0;
+  return c + d * 1e-4;
+}
+
+template<typename Real>
+Real funcFunctions(Real const& x, Real const& y) {
+  Real a = tan(x) + asin(x * 0.5) + acos(x * 0.5) + atanh(x * 0.5);
+  Real b = sinh(y) + cosh(y) + log10(y) + cbrt(y);
+  Real c = atan2(y, x) + hypot(x, y) + erf(x) + erfc(y);
+  return a + b + c + fmin(x, y) * fmax(x, y);
+}
+
+void testArithmetic(std::ostream& out) {
+  Interval a(1.0, 2.0);
+  Interval b(-1.0, 3.0);
+
+  out << "a + b = " << a + b << std::endl;
+  out << "a - b = " << a - b << std::endl;
+  out << "a * b = " << a * b << std::endl;
+  out << "b / a = " << b / a << std::endl;
+  out << "a / b = " << a / b << std::endl;
+  out << "sqr(b) = " << pow(b, 2.0) << std::endl;
+  out << "1 / 3 contains exact: " << (Interval(1.0) / 3.0).width() << std::endl;
+  out << "1 + 2 is exact: " << (Interval(1.0) + 2.0).isPoint() << std::endl;
+  out << "sin([0, 4]) = " << sin(Interval(0.0, 4.0)) << std::endl;
+  out << "cos([-1, 1]) = " << cos(Interval(-1.0, 1.0)) << std::endl;
+  out << "abs(b) = " << abs(b) << std::endl;
+  out << "sqrt([-2, -1]) = " << sqrt(Interval(-2.0, -1.0)) << std::endl;
+  out << "sqrt([-1, 4]) = " << sqrt(b) << std::endl;
+  out << "log([-2, -1]) = " << log(Interval(-2.0, -1.0)) << std::endl;
+  out << "log10([0, 100]) = " << log10(Interval(0.0, 100.0)) << std::endl;
+  out << "tan([-1, 1]) = " << tan(Interval(-1.0, 1.0)) << std::endl;
+  out << "tan([1, 2]) = " << tan(a) << std::endl;
+  out << "asin([-2, 0.5]) = " << asin(Interval(-2.0, 0.5)) << std::endl;
+  out << "acos([-0.5, 2]) = " << acos(Interval(-0.5, 2.0)) << std::endl;
+  out << "acos([2, 3]) = " << acos(Interval(2.0, 3.0)) << std::endl;
+  out << "atanh([0, 1]) = " << atanh(Interval(0.0, 1.0)) << std::endl;
+  out << "sinh(b) = " << sinh(b) << std::endl;
+  out << "cosh(b) = " << cosh(b) << std::endl;
+  out << "cbrt([-8, 27]) = " << cbrt(Interval(-8.0, 27.0)) << std::endl;
+  out << "erf(b) = " << erf(b) << std::endl;
+  out << "erfc(b) = " << erfc(b) << std::endl;
+  out << "atan2(a, a) = " << atan2(a, a) << std::endl;
+  out << "atan2(b, -a) = " << atan2(b, -a) << std::endl;
+  out << "atan2(a, b) = " << atan2(a, b) << std::endl;
+  out << "hypot(a, b) = " << hypot(a, b) << std::endl;
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+  out.precision(12);
+
+  testArithmetic(out);
+
+  // Forward mode.
+  using RealF = codi::RealForwardGen<Interval>;
+  RealF xf(Interval(0.9, 1.1));
+  RealF yf(Interval(2.0));
+  xf.gradient() = 1.0;
+  RealF zf = func(xf, yf);
+  out << "Forward: value " << zf.getValue() << " derivative " << zf.getGradient() << std::endl;
+  RealF wf = funcFunctions(xf, yf);
+  out << "Forward functions: value " << wf.getValue() << " derivative " << wf.getGradient() << std::endl;
+
+  // Reverse mode with significance analysis.
+  using Real = codi::RealReverseGen<Interval>;
+  using Tape = typename Real::Tape;
+
+  codi::SignificanceAnalysis<Real> analysis;
+
+  Tape& tape = Real::getTape();
+  tape.setActive();
+
+  Real x(Interval::withRoundingOf<float>(1.0));
+  Real y(Interval::withRoundingOf<float>(2.0));
+  tape.registerInput(x);
+  tape.registerInput(y);
+
+  Real z = func(x, y);
+  analysis.setName(z, "z");
+
+  tape.registerOutput(z);
+  tape.setPassive();
+
+  z.gradient() = 1.0;
+  tape.evaluate();
+
+  out << "Reverse: value " << z.getValue() << " derivatives " << x.getGradient() << " " << y.getGradient()
+      << std::endl;
+
+  analysis.printReport(out, 5);
+  out << "Insignificant statements below 1e-9:";
+  for (size_t i : analysis.getInsignificant(1e-9)) {
+    out << " " << i;
+  }
+  out << std::endl;
+
+  // Statements after a reset position are removed, the other entries stay.
+  Tape::Position pos = tape.getPosition();
+  tape.setActive();
+  Real w = funcFunctions(x, y);
+  tape.setPassive();
+  out << "Entries after recording: " << analysis.getEntries().size() << std::endl;
+  tape.resetTo(pos);
+  out << "Entries after resetTo: " << analysis.getEntries().size() << std::endl;
+
+  tape.reset();
+  out << "Entries after reset: " << analysis.getEntries().size() << std::endl;
+
+  out.close();
+
+  return 0;
+}
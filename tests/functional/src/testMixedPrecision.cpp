@@ -0,0 +1,93 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+size_t constexpr SumTerms = 100000;
+
+// Many small contributions to the adjoint of x.
+template<typename Real>
+double accumulationError(std::ostream& out, char const* name) {
+  using Tape = typename Real::Tape;
+  Tape& tape = Real::getTape();
+
+  Real x = 1.0f;
+  Real z = 0.0f;
+
+  tape.setActive();
+  tape.registerInput(x);
+  for (size_t i = 0; i < SumTerms; ++i) {
+    z = z + x * 1e-3f;
+  }
+  tape.registerOutput(z);
+  tape.setPassive();
+
+  z.gradient() = 1.0;
+  tape.evaluate();
+
+  double exact = (double)SumTerms * (double)1e-3f;
+  double error = std::abs((double)x.getGradient() - exact) / exact;
+
+  out << name << ": sizeof(Real) = " << sizeof(typename Real::Real)
+      << ", sizeof(Gradient) = " << sizeof(typename Real::Gradient) << std::endl;
+
+  tape.reset();
+
+  return error;
+}
+
+template<typename Real>
+void testMixed(std::ostream& out, char const* name) {
+  double errorMixed = accumulationError<Real>(out, name);
+  out << "  adjoint accumulation error below 1e-12: " << (errorMixed < 1e-12) << std::endl;
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  double errorFloat = accumulationError<codi::RealReverseGen<float>>(out, "RealReverseGen<float>");
+  out << "  adjoint accumulation error above 1e-6: " << (errorFloat > 1e-6) << std::endl;
+
+  testMixed<codi::RealReverseGen<float, double>>(out, "RealReverseGen<float, double>");
+  testMixed<codi::RealReverseIndexGen<float, double>>(out, "RealReverseIndexGen<float, double>");
+  testMixed<codi::RealReversePrimalGen<float, double>>(out, "RealReversePrimalGen<float, double>");
+  testMixed<codi::RealReversePrimalIndexGen<float, double>>(out, "RealReversePrimalIndexGen<float, double>");
+
+  out.close();
+
+  return 0;
+}
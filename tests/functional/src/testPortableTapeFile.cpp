@@ -0,0 +1,119 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_PortableTapeFiles 1
+#define CODI_ChunkSize 128
+
+#include <codi.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using Real = codi::RealReversePrimal;
+using Tape = typename Real::Tape;
+
+char const* const TapeFile = "portable.tape";
+size_t constexpr Iterations = 200;
+
+// Enough statements for several chunks, i.e. several blocks in the tape file.
+void record(Real* x, Real& y) {
+  Tape& tape = Real::getTape();
+
+  tape.setActive();
+  tape.registerInput(x[0]);
+  tape.registerInput(x[1]);
+
+  Real a = x[0];
+  Real b = x[1];
+  for (size_t i = 0; i < Iterations; ++i) {
+    Real t = a + 0.01 * sin(b);
+    b = b + 0.01 * a * cos(a);
+    a = t;
+  }
+  y = a * b;
+
+  tape.registerOutput(y);
+  tape.setPassive();
+}
+
+void evaluate(std::ostream& out, char const* name, Real* x, Real& y) {
+  Tape& tape = Real::getTape();
+
+  y.gradient() = 1.0;
+  tape.evaluate();
+
+  out << name << ": y = " << y.getValue() << ", dy/dx = {" << x[0].getGradient() << ", " << x[1].getGradient() << "}"
+      << std::endl;
+
+  tape.clearAdjoints();
+}
+
+int main(int nargs, char** args) {
+  Real x[2] = {0.7, 1.3};
+  Real y;
+
+  record(x, y);
+
+  if (2 <= nargs && 0 == std::strcmp("write", args[1])) {
+    // Child process: only write the recording.
+    Real::getTape().writeToPortableFile(TapeFile);
+
+    return 0;
+  }
+
+  std::ofstream out("run.out");
+
+  evaluate(out, "recorded", x, y);
+
+  // The file is written by a second process of this program, the evaluation handles differ between the processes.
+  std::string command = std::string(args[0]) + " write";
+  if (0 != std::system(command.c_str())) {
+    out << "Writing process failed." << std::endl;
+
+    return 1;
+  }
+
+  Real::getTape().resetHard();
+  Real::getTape().readFromPortableFile(TapeFile);
+  std::remove(TapeFile);
+
+  evaluate(out, "read from other process", x, y);
+
+  out.close();
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_IDE 0
+#define CODI_EnableStdThreads true
+
+#include <codi.hpp>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using Real = codi::RealReverseIndexStd;
+using Tape = typename Real::Tape;
+
+int const NumThreads = 4;
+int const NumRounds = 3;
+
+/// Each thread records and evaluates on its own tape. Thread ids and tapes are recycled between the rounds.
+void record(int threadNumber, double* gradient) {
+  Tape& tape = Real::getTape();
+
+  Real x = 1.0 + threadNumber;
+  tape.setActive();
+  tape.registerInput(x);
+  Real y = x;
+  for (int i = 0; i < 10 * (threadNumber + 1); i += 1) {
+    y = y * x;
+  }
+  y = y / codi::pow(x, 10 * (threadNumber + 1));
+  tape.registerOutput(y);
+  tape.setPassive();
+  y.setGradient(1.0);
+  tape.evaluate();
+
+  *gradient = x.getGradient();
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  std::ofstream out("run.out");
+
+  for (int round = 0; round < NumRounds; round += 1) {
+    std::vector<double> gradients(NumThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NumThreads; t += 1) {
+      threads.push_back(std::thread(record, t, &gradients[t]));
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    out << "Round " << round << ":";
+    for (double const& gradient : gradients) {
+      out << " " << gradient;
+    }
+    out << std::endl;
+  }
+
+  out.close();
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#define CODI_IDE 0
+
+#define CODI_TagAnalysis true
+
+#include <codi.hpp>
+#include <fstream>
+#include <iostream>
+
+using Real = codi::RealReverseTag;
+using Tape = typename Real::Tape;
+
+int main(int nargs, char** args) {
+
+  std::ofstream out("run.out");
+
+  Real x[4] = {1.0, 2.0, 3.0, 4.0};
+  Real y[4];
+
+  Tape& tape = Real::getTape();
+  tape.setAnalysisEnabled(true);
+  tape.setCurTag(1);
+  tape.setActive();
+
+  for (Real& value : x) {
+    tape.registerInput(value);
+  }
+
+  // Region 1: y[0] depends on x[0] and x[1].
+  Real t = x[0] * x[1];
+  Real c;
+  c = 2.0;            // Passive assignment.
+  Real p = c * 3.0;   // Passive statement.
+  y[0] = t + p;
+
+  // Region 2: y[1] depends on x[2], y[2] on x[1] and x[3].
+  tape.setCurTag(2);
+  tape.setTagOnVariable(x[1]);
+  tape.setTagOnVariable(x[2]);
+  tape.setTagOnVariable(x[3]);
+  tape.setTagOnVariable(y[0]);
+  y[1] = sin(x[2]);
+  for (int i = 0; i < 3; ++i) {
+    y[1] += c;
+  }
+  y[2] = x[3] / x[1];
+  Real unused = c * c;  // Passive statement.
+  (void)unused;
+
+  // Manual statement: y[3] depends on x[0] and, through y[2], on x[1] and x[3].
+  y[3].value() = 2.0 * x[0].getValue() + y[2].getValue();
+  tape.storeManual(y[3].getValue(), y[3].getIdentifier(), 2);
+  tape.pushJacobianManual(2.0, x[0].getValue(), x[0].getIdentifier());
+  tape.pushJacobianManual(1.0, y[2].getValue(), y[2].getIdentifier());
+
+  for (Real& value : y) {
+    tape.registerOutput(value);
+  }
+
+  tape.setPassive();
+
+  tape.printAnalysisReport(out);
+
+  std::vector<std::vector<size_t>> pattern = tape.getAnalysis().getSparsityPattern();
+  out << "Pattern:" << std::endl;
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    out << "  row " << i << ":";
+    for (size_t j : pattern[i]) {
+      out << " " << j;
+    }
+    out << std::endl;
+  }
+
+  tape.reset();
+
+  out.close();
+
+  return 0;
+}
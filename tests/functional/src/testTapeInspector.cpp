@@ -0,0 +1,124 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+template<typename Tape>
+void noopExternalFunction(Tape* tape, void* data, typename codi::ExternalFunction<Tape>::VectorAccess* access) {
+  codi::CODI_UNUSED(tape, data, access);
+}
+
+// Known structure: two inputs, statements with one, two and three arguments, non-finite and inexact Jacobians, one
+// external function and an overwritten variable.
+template<typename Real>
+void test(std::ostream& out, char const* name) {
+  using Tape = typename Real::Tape;
+
+  Tape& tape = Real::getTape();
+
+  Real x[2] = {2.0, 3.0};
+
+  tape.setActive();
+  tape.registerInput(x[0]);
+  tape.registerInput(x[1]);
+
+  {
+    Real a = x[0] * x[1];
+    Real b = sin(a);
+    Real c = a + b * x[0];
+    Real d = c * std::numeric_limits<double>::infinity();
+    Real e = c * std::numeric_limits<double>::quiet_NaN();
+    tape.pushExternalFunction(codi::ExternalFunction<Tape>::create(noopExternalFunction<Tape>, nullptr, nullptr));
+    Real f = c * (1.0 / 3.0);
+
+    // Reuse index managers assign the identifier of a again.
+    a = a * x[1];
+    codi::CODI_UNUSED(d, e, f);
+  }
+
+  tape.setPassive();
+
+  codi::TapeInspector<Real> inspector(tape);
+  inspector.inspect();
+
+  out << name << std::endl;
+  out << "statements: " << inspector.getStatementCount() << ", inputs: " << inspector.getInputCount()
+      << ", arguments: " << inspector.getArgumentCount()
+      << ", low level functions: " << inspector.getLowLevelFunctionCount() << std::endl;
+
+  out << "arguments per statement:";
+  for (auto const& entry : inspector.getArgumentHistogram()) {
+    out << " " << entry.first << ": " << entry.second;
+  }
+  out << std::endl;
+
+  out << "live range buckets:";
+  for (auto const& entry : inspector.getLiveRangeHistogram()) {
+    out << " " << entry.first << ": " << entry.second;
+  }
+  out << std::endl;
+
+  out << "hot identifiers:";
+  for (auto const& entry : inspector.getHotIdentifiers(3)) {
+    out << " " << entry.identifier << ": " << entry.uses;
+  }
+  out << std::endl;
+
+  out << "low level function tokens:";
+  for (auto const& entry : inspector.getLowLevelFunctionTokens()) {
+    out << " " << (size_t)entry.first << ": " << entry.second.calls;
+  }
+  out << std::endl;
+
+  inspector.writeJson(out, tape.getZeroPosition(), tape.getPosition());
+  inspector.writeGraphviz(out, tape.getZeroPosition(), tape.getPosition());
+
+  tape.reset();
+}
+
+int main(int nargs, char** args) {
+  codi::CODI_UNUSED(nargs, args);
+
+  std::ofstream out("run.out");
+
+  test<codi::RealReverse>(out, "Linear index management");
+  test<codi::RealReverseIndex>(out, "Reuse index management");
+
+  out.close();
+
+  return 0;
+}
@@ -61,7 +61,15 @@ struct CoDiForwardTape1stOrder : public CoDiReverse1stOrderBase {
     void cleanup() {}
 
     void evaluate() {
+#ifdef PARALLEL_PRIMAL
+      Tape& tape = Number::getTape();
+
+      tape.evaluatePrimalParallel();  // Builds the schedule.
+      tape.evaluatePrimalParallel();  // Uses the schedule.
+      tape.evaluateForwardParallel();
+#else
       Number::getTape().evaluateForward();
+#endif
     }
 
     void prepare() {}
@@ -40,6 +40,8 @@
 #include "basic/testExprHigherOrder.hpp"
 #include "basic/testIndices.hpp"
 #include "basic/testOutput.hpp"
+#include "basic/testReleasePrimals.hpp"
+#include "basic/testZeroAdjointRanges.hpp"
 #include "exceptions/testOneArgumentExceptions.hpp"
 #include "exceptions/testTwoArgumentExceptions.hpp"
 #include "expressions/testAssignOperators1.hpp"
@@ -54,6 +56,9 @@
 #include "externalFunctions/testExtFunctionCall.hpp"
 #include "externalFunctions/testExtFunctionCallMultiple.hpp"
 #include "io/testIO.hpp"
+#include "io/testIOCheckpoint.hpp"
+#include "io/testIOPipelined.hpp"
+#include "io/testIOPortable.hpp"
 #include "io/testSwap.hpp"
 #include "tools/helpers/testEigenLinearSystemSolverHandler.hpp"
 #include "tools/helpers/testEigenSparseLinearSystemSolverHandler.hpp"
@@ -65,9 +70,17 @@
 #include "tools/helpers/testPreaccumulationForwardInvalidAdjoint.hpp"
 #include "tools/helpers/testPreaccumulationLargeStatement.hpp"
 #include "tools/helpers/testPreaccumulationPassiveValue.hpp"
+#include "tools/helpers/testPreaccumulationScratch.hpp"
+#include "tools/helpers/testPreaccumulationSparse.hpp"
+#include "tools/helpers/testPreaccumulationLocal.hpp"
 #include "tools/helpers/testPreaccumulationZeroJacobi.hpp"
 #include "tools/helpers/testReset.hpp"
 #include "tools/helpers/testStatementPushHelper.hpp"
+#include "tools/helpers/testStatementPushHelperCSR.hpp"
+#include "tools/helpers/testTypeDispatchHelper.hpp"
 #include "tools/lowlevelFunctions/linearAlgebra/testMatrixMatrixMultiplication.hpp"
+#include "tools/testActiveVector.hpp"
+#include "tools/testPackMixedLanes.hpp"
+#include "tools/testPackReverse.hpp"
 #include "tools/testReferenceActiveType.hpp"
 #include "traits/testNumericLimits.hpp"
@@ -0,0 +1,115 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "../../testInterface.hpp"
+
+struct TestReleasePrimals : public TestInterface {
+  public:
+    NAME("ReleasePrimals")
+    IN(2)
+    OUT(2)
+    POINTS(1) = {{1.5, 0.3}};
+
+    // Statement evaluator differs from the one of the test drivers, such that the tape is not shared.
+    using Primal = codi::RealReversePrimalGen<double, double, int, codi::DirectStatementEvaluator>;
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      double xv[2] = {codi::RealTraits::getPassiveValue(x[0]), codi::RealTraits::getPassiveValue(x[1])};
+
+      // Record on a primal value tape, release the primal values and differentiate with windowed recomputation.
+      Primal::Tape& tape = Primal::getTape();
+      tape.setActive();
+
+      Primal p[2] = {xv[0], xv[1]};
+      tape.registerInput(p[0]);
+      tape.registerInput(p[1]);
+
+      Primal a = p[0];
+      Primal b = p[1];
+      for (int i = 0; i < 10; ++i) {
+        Primal c = sin(a) * b + 0.5 * p[1];
+        b = 0.5 * a + 0.1 * c;
+        a = c / (1.0 + b * b);
+      }
+
+      Primal r[2] = {a * p[0], b - 2.0 * p[1]};
+      tape.registerOutput(r[0]);
+      tape.registerOutput(r[1]);
+      tape.setPassive();
+
+      // Reference Jacobian from the regular evaluation of the same tape.
+      double jacRef[2][2];
+      for (size_t i = 0; i < 2; ++i) {
+        tape.gradient(r[i].getIdentifier()) = 1.0;
+        tape.evaluate();
+        for (size_t j = 0; j < 2; ++j) {
+          jacRef[i][j] = tape.getGradient(p[j].getIdentifier());
+        }
+        tape.clearAdjoints();
+      }
+
+      tape.releasePrimalValues();
+
+      for (size_t i = 0; i < 2; ++i) {
+        double jac[2];
+        tape.gradient(r[i].getIdentifier()) = 1.0;
+        tape.evaluate();
+        for (size_t j = 0; j < 2; ++j) {
+          jac[j] = tape.getGradient(p[j].getIdentifier());
+        }
+        tape.clearAdjoints();
+
+        y[i] = r[i].getValue();
+        for (size_t j = 0; j < 2; ++j) {
+          y[i] += jac[j] * (x[j] - xv[j]);
+
+          if (std::abs(jac[j] - jacRef[i][j]) > 1e-14 * std::max(1.0, std::abs(jacRef[i][j]))) {
+            std::cerr << "Released evaluation differs for d r_" << i << "/d x_" << j << ": " << jac[j]
+                      << " != " << jacRef[i][j] << std::endl;
+            y[i] = std::numeric_limits<double>::quiet_NaN();
+          }
+        }
+      }
+
+      tape.reset();
+    }
+};
@@ -0,0 +1,61 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include "../../testInterface.hpp"
+
+struct TestZeroAdjointRanges : public TestInterface {
+  public:
+    NAME("ZeroAdjointRanges")
+    IN(3)
+    OUT(3)
+    POINTS(2) = {{0.5, 1.5, -2.0}, {-1.0, 0.25, 3.0}};
+
+    // Long chain of statements. For each output, the chains of the other outputs have long runs of zero adjoints.
+    template<typename Number>
+    static Number chain(Number const& x) {
+      Number t = x;
+      for (int i = 0; i < 300; ++i) {
+        t = 0.99 * t + 0.01 * sin(t);
+      }
+
+      return t;
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      y[0] = chain<Number>(x[0]);
+      y[1] = chain<Number>(x[1]) * x[0];
+      y[2] = chain<Number>(x[2]) + chain<Number>(x[0] * x[1]);
+    }
+};
@@ -0,0 +1,118 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../../testInterface.hpp"
+
+struct TestIOCheckpoint : public TestInterface {
+  public:
+    NAME("IOCheckpoint")
+    IN(2)
+    OUT(2)
+    POINTS(1) = {{1.0, 0.5}};
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+#if REVERSE_TAPE
+      auto& tape = Number::getTape();
+      std::stringstream filename;
+      filename << "test" << getpid() << ".chk";
+#endif
+
+      y[0] = x[0] * x[1];
+      for (int i = 0; i < 40; ++i) {
+        y[0] = 0.5 * y[0] + x[i % 2];
+      }
+
+#if REVERSE_TAPE
+      tape.writeCheckpointToFile(filename.str(), true);
+
+      // Discarded statements overwrite parts of the checkpointed data.
+      auto pos = tape.getPosition();
+      {
+        Number t = x[0];
+        for (int i = 0; i < 40; ++i) {
+          t = 3.0 * t + x[1];
+        }
+      }
+      tape.resetTo(pos);
+#endif
+
+      y[1] = x[0] / y[0];
+      for (int i = 0; i < 20; ++i) {
+        y[1] = 0.5 * y[1] + x[(i + 1) % 2];
+      }
+
+#if REVERSE_TAPE
+      tape.writeCheckpointToFile(filename.str());
+#endif
+
+      y[0] = y[0] * y[1];
+
+#if REVERSE_TAPE
+      tape.writeCheckpointToFile(filename.str());
+
+      // A record that is torn by an interrupted write is ignored.
+      pos = tape.getPosition();
+      {
+        Number t = x[1];
+        for (int i = 0; i < 10; ++i) {
+          t = 2.0 * t + x[0];
+        }
+      }
+      tape.writeCheckpointToFile(filename.str());
+      tape.resetTo(pos);
+
+      FILE* file = fopen(filename.str().c_str(), "rb");
+      fseek(file, 0, SEEK_END);
+      long size = ftell(file);
+      fclose(file);
+      if (0 != truncate(filename.str().c_str(), size - 12)) {
+        std::cerr << "Could not truncate the checkpoint file." << std::endl;
+      }
+
+      tape.deleteData();
+      tape.readCheckpointsFromFile(filename.str());
+
+      unlink(filename.str().c_str());
+#endif
+    }
+};
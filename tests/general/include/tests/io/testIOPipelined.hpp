@@ -0,0 +1,91 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../../testInterface.hpp"
+
+struct TestIOPipelined : public TestInterface {
+  public:
+    NAME("IOPipelined")
+    IN(2)
+    OUT(2)
+    POINTS(1) = {{1.0, 0.5}};
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      y[0] = x[0] * x[1];
+      for (int i = 0; i < 20; ++i) {
+        y[0] = 0.5 * y[0] + x[i % 2];
+      }
+      y[1] = x[0] / y[0];
+
+#if REVERSE_TAPE
+      auto& tape = Number::getTape();
+      std::stringstream filename;
+      filename << "test" << getpid() << ".tape";
+
+      codi::FileIoOptions options(4, true);
+      tape.writeToFile(filename.str(), options);
+
+      // Errors of the IO threads are reported to the caller.
+      std::string truncatedName = filename.str() + ".truncated";
+      tape.writeToFile(truncatedName, options);
+      if (0 != truncate(truncatedName.c_str(), 16)) {
+        std::cerr << "Could not truncate " << truncatedName << std::endl;
+      }
+      bool truncatedFails = false;
+      try {
+        tape.readFromFile(truncatedName, options);
+      } catch (codi::IoException const&) {
+        truncatedFails = true;
+      }
+      unlink(truncatedName.c_str());
+      if (!truncatedFails) {
+        std::cerr << "Reading a truncated file did not fail." << std::endl;
+        y[1] = 0.0;
+      }
+
+      tape.deleteData();
+      tape.readFromFile(filename.str(), options);
+
+      unlink(filename.str().c_str());
+#endif
+    }
+};
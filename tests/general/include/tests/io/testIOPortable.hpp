@@ -0,0 +1,101 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <sstream>
+#include <string>
+
+#include "../../testInterface.hpp"
+
+struct TestIOPortable : public TestInterface {
+  public:
+    NAME("IOPortable")
+    IN(2)
+    OUT(2)
+    POINTS(1) = {{1.5, 0.3}};
+
+    // Statement evaluator differs from the one of the test drivers, such that the tape is not shared.
+    using Primal = codi::RealReversePrimalGen<double, double, int, codi::ReverseStatementEvaluator>;
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      double xv[2] = {codi::RealTraits::getPassiveValue(x[0]), codi::RealTraits::getPassiveValue(x[1])};
+
+      // Record on a primal value tape, restore the recording from a portable file and differentiate it.
+      Primal::Tape& tape = Primal::getTape();
+      tape.setActive();
+
+      Primal p[2] = {xv[0], xv[1]};
+      tape.registerInput(p[0]);
+      tape.registerInput(p[1]);
+
+      codi::PreaccumulationHelper<Primal> ph;
+      ph.start(p[0], p[1]);
+      Primal t = sin(p[0]) * p[1] + 3.0 * exp(p[1]) / p[0];
+      ph.finish(false, t);
+
+      Primal r[2] = {t * t, t - 2.0 * p[1]};
+      tape.registerOutput(r[0]);
+      tape.registerOutput(r[1]);
+      tape.setPassive();
+
+      std::stringstream filename;
+      filename << "test" << getpid() << ".portable.tape";
+
+      tape.writeToPortableFile(filename.str());
+      tape.resetHard();
+      tape.readFromPortableFile(filename.str());
+
+      unlink(filename.str().c_str());
+
+      for (size_t i = 0; i < 2; ++i) {
+        double jac[2];
+        tape.gradient(r[i].getIdentifier()) = 1.0;
+        tape.evaluate();
+        for (size_t j = 0; j < 2; ++j) {
+          jac[j] = tape.getGradient(p[j].getIdentifier());
+        }
+        tape.clearAdjoints();
+
+        y[i] = r[i].getValue();
+        for (size_t j = 0; j < 2; ++j) {
+          y[i] += jac[j] * (x[j] - xv[j]);
+        }
+      }
+
+      tape.reset();
+    }
+};
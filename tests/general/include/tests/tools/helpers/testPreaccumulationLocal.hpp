@@ -0,0 +1,77 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../../../testInterface.hpp"
+
+struct TestPreaccumulationLocal : public TestInterface {
+  public:
+    NAME("PreaccumulationLocal")
+    IN(4)
+    OUT(6)
+    POINTS(1) = {{1.0, 0.5, 2.0, -1.5}};
+
+    template<typename Number>
+    static void evalFunc(Number* x, Number* y) {
+      Number t = x[0] * x[1];
+      for (int i = 0; i < 3; ++i) {
+        t = sin(t) + x[2] * x[i];
+      }
+      y[0] = t * x[3];
+      y[1] = t / x[2];
+      y[2] = x[0] + x[1];
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      codi::PreaccumulationHelper<Number> ph;
+
+      // Inputs are intermediate values, their identifiers are not the first ones of the tape.
+      Number a = x[0] * x[3];
+      Number b = x[1] + x[2];
+
+      ph.start(a, b, x[2], x[3]);
+      Number in[4] = {a, b, x[2], x[3]};
+      evalFunc(in, y);
+      ph.finishLocal(y[0], y[1], y[2]);
+
+      ph.setMode(codi::PreaccumulationMode::Sparse);
+      ph.start(x[0], x[1], x[2], x[3]);
+      evalFunc(x, &y[3]);
+      ph.finishLocal(y[3], y[4], y[5]);
+
+      y[0] += y[3] * a;
+    }
+};
@@ -0,0 +1,75 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../../../testInterface.hpp"
+
+struct TestPreaccumulationScratch : public TestInterface {
+  public:
+    NAME("PreaccumulationScratch")
+    IN(3)
+    OUT(4)
+    POINTS(1) = {{1.0, 0.5, -2.0}};
+
+    template<typename Number>
+    static void evalFunc(Number* x, Number* y) {
+      Number t = x[0];
+      for (int i = 0; i < 5; ++i) {
+        t = t * x[1] + sin(x[2]);
+      }
+      y[0] = t;
+      y[1] = t * x[2];
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      codi::PreaccumulationHelper<Number> ph;
+      ph.setUseScratchTape(true);
+
+      ph.start(x[0], x[1], x[2]);
+      evalFunc(x, y);
+      ph.finish(false, y[0], y[1]);
+
+      Number a = y[0] * x[0];
+
+      ph.setMode(codi::PreaccumulationMode::Sparse);
+      ph.start(a, x[1], x[2]);
+      Number in[3] = {a, x[1], x[2]};
+      evalFunc(in, &y[2]);
+      ph.finishLocal(y[2], y[3]);
+
+      y[3] += y[1];
+    }
+};
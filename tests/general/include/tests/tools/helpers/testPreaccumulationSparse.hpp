@@ -0,0 +1,97 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include "../../../testInterface.hpp"
+#include <codi.hpp>
+
+#include "../../../testInterface.hpp"
+
+struct TestPreaccumulationSparse : public TestInterface {
+  public:
+    NAME("PreaccumulationSparse")
+    IN(6)
+    OUT(12)
+    POINTS(1) = {{1.0, 0.5, 2.0, -1.5, 0.25, 3.0}};
+
+    // One dense row, compressed reverse mode.
+    template<typename Number>
+    static void evalFuncDenseRow(Number* x, Number* y) {
+      y[0] = x[0] * x[1];
+      y[1] = x[2] / x[3];
+      y[2] = sin(x[4]) * x[5];
+      y[3] = x[0];
+      for (int i = 1; i < 6; ++i) {
+        y[3] += x[i] * x[i];
+      }
+    }
+
+    // One dense column, compressed forward mode.
+    template<typename Number>
+    static void evalFuncDenseColumn(Number* x, Number* y) {
+      y[0] = x[0] * x[5];
+      y[1] = x[0] + x[1] * x[2];
+      y[2] = exp(x[0]) * x[3];
+      y[3] = x[0] - cos(x[4]);
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      codi::PreaccumulationHelper<Number> ph;
+      ph.setMode(codi::PreaccumulationMode::Sparse);
+
+      ph.start(x[0], x[1], x[2], x[3], x[4], x[5]);
+      evalFuncDenseRow(x, y);
+      ph.finish(false, y[0], y[1], y[2], y[3]);
+
+      ph.start(x[0], x[1], x[2], x[3], x[4], x[5]);
+      evalFuncDenseColumn(x, &y[4]);
+      ph.finish(false, y[4], y[5], y[6], y[7]);
+
+      // The first region measures the pattern, the second one is decided from the measurement.
+      codi::PreaccumulationHelper<Number> phAuto;
+      phAuto.setMode(codi::PreaccumulationMode::Automatic);
+
+      phAuto.start(x[0], x[1], x[2], x[3], x[4], x[5]);
+      evalFuncDenseColumn(x, &y[8]);
+      phAuto.finish(false, y[8], y[9], y[10], y[11]);
+
+      Number t[4];
+      phAuto.start(x[0], x[1], x[2], x[3], x[4], x[5]);
+      evalFuncDenseRow(x, t);
+      phAuto.finish(false, t[0], t[1], t[2], t[3]);
+      for (int i = 0; i < 4; ++i) {
+        y[8 + i] += t[i];
+      }
+    }
+};
@@ -0,0 +1,75 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+#include <limits>
+#include <vector>
+
+#include "../../../testInterface.hpp"
+
+struct TestStatementPushHelperCSR : public TestInterface {
+  public:
+    NAME("StatementPushHelperCSR")
+    IN(2)
+    OUT(6)
+    POINTS(1) = {// clang-format off
+      {  1.0,     0.5}
+    };  // clang-format on
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      using Real = codi::RealTraits::PassiveReal<Number>;
+
+      codi::StatementPushHelper<Number> ph;
+
+      std::vector<Number> args;
+      args.push_back(x[0]);
+      args.push_back(x[1]);
+      args.push_back(codi::RealTraits::getPassiveValue(x[0]));
+
+      // row 0: two valid dependencies
+      // row 1: one invalid dependency jac == 0
+      // row 2: one invalid dependency index == 0
+      // row 3: same argument twice
+      // row 4: no arguments
+      // row 5: one invalid dependency jac == inf
+      std::vector<size_t> rowPointers = {0, 2, 4, 6, 8, 8, 10};
+      std::vector<int> columns = {0, 1, 1, 0, 0, 2, 1, 1, 0, 1};
+      std::vector<Real> jacobians = {11.0, 12.0, 21.0, 0.0, 31.0, 32.0, 41.0, 42.0, 51.0,
+                                     std::numeric_limits<Real>::infinity()};
+      std::vector<Real> primals = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+      ph.pushStatementsCSR(y, primals, 6, args, rowPointers, columns, jacobians);
+    }
+};
@@ -0,0 +1,81 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../../../testInterface.hpp"
+
+struct TestTypeDispatchHelper : public TestInterface {
+  public:
+    NAME("TypeDispatchHelper")
+    IN(3)
+    OUT(3)
+    POINTS(1) = {{1.0, 0.5, -2.0}};
+
+    struct Step {
+        template<typename View>
+        void operator()(View const& state, double factor) const {
+          for (size_t i = 0; i + 1 < state.size(); ++i) {
+            state[i + 1] = state[i + 1] + factor * sin(state[i]);
+          }
+        }
+    };
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      codi::TypeDispatchHelper<typename Number::Real, Number> helper(3);
+
+      // Passive step on the primal values.
+      for (size_t i = 0; i < 3; ++i) {
+        helper.primalData()[i] = codi::RealTraits::getPassiveValue(x[i]) * 0.5;
+      }
+      helper.dispatch(Step(), 0.5);
+
+      // Active step on the same values.
+      helper.template setType<Number>();
+      typename codi::TypeDispatchHelper<typename Number::Real, Number>::template View<Number> state =
+          helper.template view<Number>();
+      for (size_t i = 0; i < 3; ++i) {
+        state[i] = state[i] * x[i];
+      }
+      helper.dispatch(Step(), 2.0);
+
+      for (size_t i = 0; i < 3; ++i) {
+        y[i] = state[i];
+      }
+
+      helper.setTypeIndex(0);
+      helper.dispatch(Step(), 1.0);
+    }
+};
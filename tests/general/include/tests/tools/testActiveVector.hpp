@@ -0,0 +1,70 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../../testInterface.hpp"
+
+struct TestActiveVector : public TestInterface {
+  public:
+    NAME("ActiveVector")
+    IN(3)
+    OUT(4)
+    POINTS(1) = {{1.0, 0.5, -2.0}};
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      codi::ActiveVector<Number> v(3);
+      for (size_t i = 0; i < 3; ++i) {
+        v[i] = x[i];
+      }
+
+      // Kernel that reads the primal values for a condition and records the active update.
+      typename Number::Real const* primals = v.primalData();
+      for (size_t i = 0; i < v.size(); ++i) {
+        if (primals[i] > 0.0) {
+          v[i] = v[i] * v[(i + 1) % 3];
+        } else {
+          v[i] = sin(v[i]) + x[0];
+        }
+      }
+
+      codi::ActiveVector<Number> const copy = v;
+      v.push_back(copy[0] * copy[2]);
+
+      for (size_t i = 0; i < 4; ++i) {
+        y[i] = v[i];
+      }
+    }
+};
@@ -0,0 +1,95 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../../testInterface.hpp"
+
+struct TestPackMixedLanes : public TestInterface {
+  public:
+    NAME("PackMixedLanes")
+    IN(2)
+    OUT(4)
+    POINTS(1) = {{0.5, 0.5}};
+
+    using Pack = codi::Pack<double, 4>;
+    using PackType = codi::RealReversePack<4>;
+
+    template<typename T>
+    static T g(T const* p) {
+      T t = abs(p[0]) * max(p[0], p[1]) + min(p[0], 0.5 * p[1]) + fmax(p[0], 0.0) * fmin(p[1], 1.0);
+      t += atan2(p[0], p[1]) + erf(p[1]) + hypot(p[0], p[1]);
+      return t + sqrt(fabs(p[0])) + cbrt(p[1] - 1.0);
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      double xv[2] = {codi::RealTraits::getPassiveValue(x[0]), codi::RealTraits::getPassiveValue(x[1])};
+
+      // The lane offsets place the lanes on different branches of abs, min, max, fmin and fmax.
+      double const offsets[2][4] = {{-2.0, -0.75, 0.25, 1.5}, {1.0, -0.5, 0.0, -1.25}};
+
+      PackType::Tape& tape = PackType::getTape();
+      tape.setActive();
+
+      PackType p[2];
+      for (size_t j = 0; j < 2; ++j) {
+        Pack value;
+        for (size_t k = 0; k < Pack::lanes; ++k) {
+          value[k] = xv[j] + offsets[j][k];
+        }
+        p[j] = value;
+        tape.registerInput(p[j]);
+      }
+      PackType r = g(p);
+      tape.registerOutput(r);
+      tape.setPassive();
+
+      Pack jac[2];
+      r.gradient() = Pack(1.0);
+      tape.evaluate();
+      for (size_t j = 0; j < 2; ++j) {
+        jac[j] = p[j].getGradient();
+      }
+      tape.reset();
+
+      // Each lane has to match the scalar evaluation at its point.
+      for (size_t k = 0; k < Pack::lanes; ++k) {
+        y[k] = r.getValue()[k];
+        for (size_t j = 0; j < 2; ++j) {
+          y[k] += jac[j][k] * (x[j] - xv[j]);
+        }
+      }
+    }
+};
@@ -0,0 +1,92 @@
+/*
+ * CoDiPack, a Code Differentiation Package
+ *
+ * Copyright (C) 2015-2024 Chair for Scientific Computing (SciComp), University of Kaiserslautern-Landau
+ * Homepage: http://scicomp.rptu.de
+ * Contact:  Prof. Nicolas R. Gauger (codi@scicomp.uni-kl.de)
+ *
+ * Lead developers: Max Sagebaum, Johannes Blühdorn (SciComp, University of Kaiserslautern-Landau)
+ *
+ * This file is part of CoDiPack (http://scicomp.rptu.de/software/codi).
+ *
+ * CoDiPack is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * CoDiPack is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ * You should have received a copy of the GNU
+ * General Public License along with CoDiPack.
+ * If not, see <http://www.gnu.org/licenses/>.
+ *
+ * For other licensing options please contact us.
+ *
+ * Authors:
+ *  - SciComp, University of Kaiserslautern-Landau:
+ *    - Max Sagebaum
+ *    - Johannes Blühdorn
+ *    - Former members:
+ *      - Tim Albring
+ */
+#include <codi.hpp>
+
+#include "../../testInterface.hpp"
+
+struct TestPackReverse : public TestInterface {
+  public:
+    NAME("PackReverse")
+    IN(2)
+    OUT(4)
+    POINTS(1) = {{1.0, 0.5}};
+
+    using Pack = codi::Pack<double, 4>;
+    using PackType = codi::RealReversePack<4>;
+
+    template<typename T>
+    static T g(T const* p) {
+      T t = sin(p[0]) * p[1] + exp(p[1]) / p[0];
+      return sqrt(t * t + 1.0) - 2.0 * p[0];
+    }
+
+    template<typename Number>
+    static void func(Number* x, Number* y) {
+      double xv[2] = {codi::RealTraits::getPassiveValue(x[0]), codi::RealTraits::getPassiveValue(x[1])};
+
+      // Lane k evaluates g at a shifted point, all lanes are recorded and reversed at once.
+      PackType::Tape& tape = PackType::getTape();
+      tape.setActive();
+
+      PackType p[2];
+      for (size_t j = 0; j < 2; ++j) {
+        Pack value;
+        for (size_t k = 0; k < Pack::lanes; ++k) {
+          value[k] = xv[j] + 0.25 * k;
+        }
+        p[j] = value;
+        tape.registerInput(p[j]);
+      }
+      PackType r = g(p);
+      tape.registerOutput(r);
+      tape.setPassive();
+
+      Pack jac[2];
+      r.gradient() = Pack(1.0);
+      tape.evaluate();
+      for (size_t j = 0; j < 2; ++j) {
+        jac[j] = p[j].getGradient();
+      }
+      tape.reset();
+
+      // Linearization around the lane points, only the Jacobian is visible in the derivatives.
+      for (size_t k = 0; k < Pack::lanes; ++k) {
+        y[k] = r.getValue()[k];
+        for (size_t j = 0; j < 2; ++j) {
+          y[k] += jac[j][k] * (x[j] - xv[j]);
+        }
+      }
+    }
+};